@@ -19,11 +19,7 @@ uint8 *ptrCSRA = &(ADC->ADCSRA.ADCSRA_REG);
 
 LCD_t LCD2;
 uint16 data;
-void ADC_ISR(void){
-	data = ADC->ADCLH.ADCLH_REG;
-			LCD_Send_Number_Pos(&LCD2, data, LCD_FIRST_ROW, 1);
-
-}
+ADC_Handle_t ADC_handle;
 
 int main(void){
 
@@ -62,13 +58,17 @@ int main(void){
 //	LCD_Send_String(&LCD2, (uint8*)"Direction: ");
 
 	ADC_cfg myADC = {.reference_voltage = ADC_REFERENCE_AREF, .prescaler = ADC_PRESCALE_64, .data_adjust = ADC_ADJUST_RIGHT,
-			.interrupt_status = ADC_INTERRUPT_ENABLE, .pf_callback = ADC_ISR};
+			.interrupt_status = ADC_INTERRUPT_ENABLE, .pf_callback = NULL};
 	ADC_Init(&myADC);
 
 	while(1){
-		ADC_Start_Conversion(ADC_PIN_0, &data, pollingDisable);
+		ADC_Start(&ADC_handle, ADC_PIN_0);
+		/* Conversion runs in the background, wait at least ~1 ms for the result */
+		if(RET_OK == ADC_Wait(&ADC_handle, &data, 1000)){
+			LCD_Send_Command(&LCD2, LCD_CLEAR_DISPLAY);
+			LCD_Send_Number_Pos(&LCD2, data, LCD_FIRST_ROW, 1);
+		}
 		_delay_ms(750);
-					LCD_Send_Command(&LCD2, LCD_CLEAR_DISPLAY);
 	}
 	return 0;
 }
@@ -0,0 +1,103 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : CP_interface.h                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef HAL_CHARLIEPLEX_CP_INTERFACE_H_
+#define HAL_CHARLIEPLEX_CP_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../../MCAL/GPIO/GPIO_interface.h"
+
+//----------------------------------------------
+// Section: Macros Configuration
+//----------------------------------------------
+
+/* Capacity of CP_t, N pins drive N * (N - 1) LEDs */
+#define CP_MAX_PINS			6
+#define CP_MAX_LEDS			(CP_MAX_PINS * (CP_MAX_PINS - 1))
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	/* Configuration, set by the user */
+	GPIO_Typedef	*GPIOx;					// all pins on one port
+	uint8			pins;					// pins in use, 2 -> CP_MAX_PINS
+	uint8			PIN[CP_MAX_PINS];		// @ref GPIO_PIN_define
+	/* Port images of each LED, computed by CP_Init */
+	uint8			mask;
+	uint8			leds;
+	uint8			ddr_image[CP_MAX_LEDS];
+	uint8			port_image[CP_MAX_LEDS];
+	/* LED states, one bit per LED */
+	volatile uint8	state[(CP_MAX_LEDS + 7) / 8];
+	/* Runtime data, updated by CP_Refresh */
+	uint8			current;
+}CP_t;
+
+/*
+ * =============================================
+ * APIs Supported by "Charlieplex"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- CP_Init
+ * @brief 		- Computes the port images of every LED and leaves all pins floating
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Each pin needs its own series resistor. All LEDs start off
+ */
+Std_Returntype CP_Init(CP_t *_CP);
+
+/**=============================================
+ * @Fn			- CP_Get_Index
+ * @brief 		- Returns the LED index of an anode and cathode pin pair
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @param [in] 	- anode: index of the anode pin in PIN[]
+ * @param [in] 	- cathode: index of the cathode pin in PIN[]
+ * @param [out] - index: pointer to the variable that will return the LED index
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- index = anode * (pins - 1) + cathode, minus 1 when cathode > anode
+ */
+Std_Returntype CP_Get_Index(const CP_t *_CP, uint8 anode, uint8 cathode, uint8 *index);
+
+/**=============================================
+ * @Fn			- CP_Set
+ * @brief 		- Turns one LED on or off
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @param [in] 	- index: LED index (0 -> pins * (pins - 1) - 1)
+ * @param [in] 	- state: 1 to turn the LED on, 0 to turn it off
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM bitmap is written, CP_Refresh shows it
+ */
+Std_Returntype CP_Set(CP_t *_CP, uint8 index, uint8 state);
+
+/**=============================================
+ * @Fn			- CP_Clear
+ * @brief 		- Turns all LEDs off
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM bitmap is written, CP_Refresh shows it
+ */
+Std_Returntype CP_Clear(CP_t *_CP);
+
+/**=============================================
+ * @Fn			- CP_Refresh
+ * @brief 		- Moves the display to the next LED
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call from a timer ISR. Every LED gets one time slot per frame whether it is
+ * 				  lit or not, so the brightness does not depend on how many LEDs are on.
+ * 				  Refresh rate = tick rate / (pins * (pins - 1)), keep it above ~60 Hz.
+ * 				  Each step floats the pins, writes PORT then DDR, three masked port writes
+ */
+Std_Returntype CP_Refresh(CP_t *_CP);
+
+#endif /* HAL_CHARLIEPLEX_CP_INTERFACE_H_ */
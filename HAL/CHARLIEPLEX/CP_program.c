@@ -0,0 +1,147 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : CP_program.c                           				 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "CP_interface.h"
+#include "../../SERVICES/BIT_MATH.h"
+
+/**=============================================
+ * @Fn			- CP_Init
+ * @brief 		- Computes the port images of every LED and leaves all pins floating
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Each pin needs its own series resistor. All LEDs start off
+ */
+Std_Returntype CP_Init(CP_t *_CP){
+	Std_Returntype ret = RET_OK;
+	uint8 anode, cathode, index = 0;
+	if((NULL == _CP) || (NULL == _CP->GPIOx) || (2 > _CP->pins) || (CP_MAX_PINS < _CP->pins))
+		ret = RET_NOT_OK;
+	else{
+		_CP->mask = 0;
+		for(anode = 0; anode < _CP->pins; anode++){
+			if((GPIO_PIN_7 < _CP->PIN[anode]) || (_CP->mask & (1U << _CP->PIN[anode])))
+				ret = RET_NOT_OK;
+			else
+				_CP->mask |= (1U << _CP->PIN[anode]);
+		}
+		if(RET_OK == ret){
+			/* LED order matches CP_Get_Index */
+			for(anode = 0; anode < _CP->pins; anode++){
+				for(cathode = 0; cathode < _CP->pins; cathode++){
+					if(anode != cathode){
+						_CP->port_image[index] = (1U << _CP->PIN[anode]);
+						_CP->ddr_image[index] = (1U << _CP->PIN[anode]) | (1U << _CP->PIN[cathode]);
+						index++;
+					}
+				}
+			}
+			_CP->leds = index;
+			for(index = 0; index < sizeof(_CP->state); index++)
+				_CP->state[index] = 0;
+			_CP->current = 0;
+			/* Floating without pull-ups */
+			_CP->GPIOx->DDR &= ~(_CP->mask);
+			_CP->GPIOx->PORT &= ~(_CP->mask);
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- CP_Get_Index
+ * @brief 		- Returns the LED index of an anode and cathode pin pair
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @param [in] 	- anode: index of the anode pin in PIN[]
+ * @param [in] 	- cathode: index of the cathode pin in PIN[]
+ * @param [out] - index: pointer to the variable that will return the LED index
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- index = anode * (pins - 1) + cathode, minus 1 when cathode > anode
+ */
+Std_Returntype CP_Get_Index(const CP_t *_CP, uint8 anode, uint8 cathode, uint8 *index){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _CP) || (NULL == index) || (anode >= _CP->pins) || (cathode >= _CP->pins) || (anode == cathode))
+		ret = RET_NOT_OK;
+	else
+		*index = (anode * (_CP->pins - 1)) + ((cathode > anode) ? (cathode - 1) : cathode);
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- CP_Set
+ * @brief 		- Turns one LED on or off
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @param [in] 	- index: LED index (0 -> pins * (pins - 1) - 1)
+ * @param [in] 	- state: 1 to turn the LED on, 0 to turn it off
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM bitmap is written, CP_Refresh shows it
+ */
+Std_Returntype CP_Set(CP_t *_CP, uint8 index, uint8 state){
+	Std_Returntype ret = RET_OK;
+	uint8 bit = index & 7;
+	if((NULL == _CP) || (index >= _CP->leds))
+		ret = RET_NOT_OK;
+	else if(state)
+		SET_BIT(_CP->state[index >> 3], bit);
+	else
+		CLR_BIT(_CP->state[index >> 3], bit);
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- CP_Clear
+ * @brief 		- Turns all LEDs off
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM bitmap is written, CP_Refresh shows it
+ */
+Std_Returntype CP_Clear(CP_t *_CP){
+	Std_Returntype ret = RET_OK;
+	uint8 index;
+	if(NULL == _CP)
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < sizeof(_CP->state); index++)
+			_CP->state[index] = 0;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- CP_Refresh
+ * @brief 		- Moves the display to the next LED
+ * @param [in] 	- _CP: pointer to the charlieplex configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call from a timer ISR. Every LED gets one time slot per frame whether it is
+ * 				  lit or not, so the brightness does not depend on how many LEDs are on.
+ * 				  Refresh rate = tick rate / (pins * (pins - 1)), keep it above ~60 Hz.
+ * 				  Each step floats the pins, writes PORT then DDR, three masked port writes
+ */
+Std_Returntype CP_Refresh(CP_t *_CP){
+	Std_Returntype ret = RET_OK;
+	uint8 current, bit, port_image = 0, ddr_image = 0;
+	if(NULL == _CP)
+		ret = RET_NOT_OK;
+	else{
+		current = _CP->current + 1;
+		if(current >= _CP->leds)
+			current = 0;
+		_CP->current = current;
+		/* An off LED still takes its slot with all pins floating */
+		bit = current & 7;
+		if(GET_BIT(_CP->state[current >> 3], bit)){
+			port_image = _CP->port_image[current];
+			ddr_image = _CP->ddr_image[current];
+		}
+		/* Float first, otherwise the old cathode briefly lights a LED of the new anode */
+		_CP->GPIOx->DDR &= ~(_CP->mask);
+		_CP->GPIOx->PORT = (_CP->GPIOx->PORT & ~(_CP->mask)) | port_image;
+		_CP->GPIOx->DDR |= ddr_image;
+	}
+	return ret;
+}
@@ -0,0 +1,108 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : ENC_interface.h                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef HAL_ENCODER_ENC_INTERFACE_H_
+#define HAL_ENCODER_ENC_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/EXTI/EXTI_interface.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	/* Configuration, set by the user */
+	uint8			steps_per_detent;	// @ref ENC_STEPS_define
+	uint8			acceleration;		// @ref ENC_ACCEL_define
+	/* Runtime data */
+	volatile sint32	position;			// quadrature transitions, updated from the ISR
+	volatile uint8	state;				// last A/B state
+	volatile uint16	error_count;		// invalid transitions (bounce)
+	sint32			last_position;		// position at the previous ENC_Update
+	sint32			reported_position;	// position at the previous ENC_Get_Delta
+	sint16			velocity;			// filtered transitions per ENC_Update period, Q4
+}ENC_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+/* Channel A must be wired to INT0 (PD2) and channel B to INT1 (PD3) */
+
+// @ref ENC_STEPS_define
+#define ENC_STEPS_1					1
+#define ENC_STEPS_2					2
+#define ENC_STEPS_4					4
+
+// @ref ENC_ACCEL_define
+#define ENC_ACCEL_OFF				0
+#define ENC_ACCEL_ON				1
+
+/* Acceleration: detents are multiplied by 1 + |velocity| / ENC_ACCEL_DIVISOR, up to ENC_ACCEL_MAX */
+#define ENC_ACCEL_DIVISOR			(4 << 4)
+#define ENC_ACCEL_MAX				10
+
+/*
+ * =============================================
+ * APIs Supported by "Encoder"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- ENC_Init
+ * @brief 		- Configures INT0/INT1 on any change and starts decoding the encoder
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only one encoder is supported. It subscribes to INT0 and INT1 on any change,
+ * 				  other modules may share the lines. Fails when a subscriber table is full
+ */
+Std_Returntype ENC_Init(ENC_t *_ENC);
+
+/**=============================================
+ * @Fn			- ENC_Get_Position
+ * @brief 		- Returns the absolute position in detents
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @param [out] - position: pointer to the variable that will return the position
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ENC_Get_Position(ENC_t *_ENC, sint32 *position);
+
+/**=============================================
+ * @Fn			- ENC_Get_Delta
+ * @brief 		- Returns the detents moved since the previous call, scaled by the acceleration
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @param [out] - delta: pointer to the variable that will return the signed movement
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Partial detents are kept for the next call
+ */
+Std_Returntype ENC_Get_Delta(ENC_t *_ENC, sint16 *delta);
+
+/**=============================================
+ * @Fn			- ENC_Update
+ * @brief 		- Updates the velocity estimation, to be called at a fixed rate
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Velocity is low-pass filtered (1/4 new sample)
+ */
+Std_Returntype ENC_Update(ENC_t *_ENC);
+
+/**=============================================
+ * @Fn			- ENC_Get_Velocity
+ * @brief 		- Returns the filtered velocity
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @param [out] - velocity: pointer to the variable that will return transitions per ENC_Update period in Q4
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ENC_Get_Velocity(ENC_t *_ENC, sint16 *velocity);
+
+#endif /* HAL_ENCODER_ENC_INTERFACE_H_ */
@@ -0,0 +1,202 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : ENC_program.c                           				 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "ENC_interface.h"
+
+/* A = PD2 (INT0), B = PD3 (INT1) */
+#define ENC_STATE_SHIFT		2
+#define ENC_STATE_MASK		0x03
+
+/* Largest movement per ENC_Update that fits the Q4 sint16 velocity */
+#define ENC_MOVED_MAX		(32767L / 16)
+
+/* Indexed by (previous state << 2) | new state, 0 for no movement or an invalid double change */
+static const sint8 ENC_Transition_Table[16] = {
+		 0, -1,  1,  0,
+		 1,  0,  0, -1,
+		-1,  0,  0,  1,
+		 0,  1, -1,  0
+};
+
+static ENC_t *ENC_Instance;
+
+/* Edge handler of both INT0 and INT1, runs in the EXTI ISR. Reads PIND directly so a
+ * statically bound vector does not make any call */
+static inline void ENC_Edge(void){
+	ENC_t *enc = ENC_Instance;
+	uint8 new_state, index;
+	new_state = (GPIOD->PIN >> ENC_STATE_SHIFT) & ENC_STATE_MASK;
+	index = (enc->state << 2) | new_state;
+	enc->position += ENC_Transition_Table[index];
+	/* Both channels changed at once: bounce or missed edge */
+	if((enc->state ^ new_state) == ENC_STATE_MASK)
+		enc->error_count++;
+	enc->state = new_state;
+}
+
+#if (EXTI_BINDING_STATIC == EXTI_INT0_BINDING)
+EXTI_BIND_ISR(EXTI_INT0_VECTOR, ENC_Edge)
+#endif
+#if (EXTI_BINDING_STATIC == EXTI_INT1_BINDING)
+EXTI_BIND_ISR(EXTI_INT1_VECTOR, ENC_Edge)
+#endif
+
+static sint32 ENC_Read_Position(ENC_t *_ENC){
+	sint32 position;
+	uint8 sreg_state = SREG;
+	GLOBAL_INTERRUPT_DISABLE();
+	position = _ENC->position;
+	SREG = sreg_state;
+	return position;
+}
+
+/**=============================================
+ * @Fn			- ENC_Init
+ * @brief 		- Configures INT0/INT1 on any change and starts decoding the encoder
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only one encoder is supported. It subscribes to INT0 and INT1 on any change,
+ * 				  other modules may share the lines. Fails when a subscriber table is full
+ */
+Std_Returntype ENC_Init(ENC_t *_ENC){
+	Std_Returntype ret = RET_OK;
+	EXTI_cfg line_cfg = {.mode = EXTI_TRIGGER_ANY_CHANGE, .dispatch = EXTI_DISPATCH_CALLBACK, .pf_CallBack = NULL};
+	uint8 port_state, handle_int0, handle_int1, sreg_state;
+	if((NULL == _ENC) || (0 == _ENC->steps_per_detent))
+		ret = RET_NOT_OK;
+	else{
+		_ENC->position = 0;
+		_ENC->error_count = 0;
+		_ENC->last_position = 0;
+		_ENC->reported_position = 0;
+		_ENC->velocity = 0;
+		GPIO_PORT_Read(GPIOD, &port_state);
+		_ENC->state = (port_state >> ENC_STATE_SHIFT) & ENC_STATE_MASK;
+
+		/* ENC_Edge stays subscribed when the encoder is initialized again */
+		if(NULL == ENC_Instance){
+			ENC_Instance = _ENC;
+			ret = EXTI_Subscribe(EXTI_INT0, ENC_Edge, EXTI_PRIORITY_HIGHEST, &handle_int0);
+			if(RET_OK == ret){
+				ret = EXTI_Subscribe(EXTI_INT1, ENC_Edge, EXTI_PRIORITY_HIGHEST, &handle_int1);
+				if(RET_OK != ret)
+					EXTI_Unsubscribe(EXTI_INT0, handle_int0);
+			}
+			if(RET_OK != ret)
+				ENC_Instance = NULL;
+		}
+		else{
+			sreg_state = SREG;
+			GLOBAL_INTERRUPT_DISABLE();
+			ENC_Instance = _ENC;
+			SREG = sreg_state;
+		}
+
+		if(RET_OK == ret){
+			line_cfg.number = EXTI_INT0;
+			ret |= EXTI_Init(&line_cfg);
+			line_cfg.number = EXTI_INT1;
+			ret |= EXTI_Init(&line_cfg);
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ENC_Get_Position
+ * @brief 		- Returns the absolute position in detents
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @param [out] - position: pointer to the variable that will return the position
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ENC_Get_Position(ENC_t *_ENC, sint32 *position){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _ENC) || (NULL == position))
+		ret = RET_NOT_OK;
+	else
+		*position = ENC_Read_Position(_ENC) / _ENC->steps_per_detent;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ENC_Get_Delta
+ * @brief 		- Returns the detents moved since the previous call, scaled by the acceleration
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @param [out] - delta: pointer to the variable that will return the signed movement
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Partial detents are kept for the next call
+ */
+Std_Returntype ENC_Get_Delta(ENC_t *_ENC, sint16 *delta){
+	Std_Returntype ret = RET_OK;
+	sint32 moved;
+	sint16 detents, speed, factor;
+	if((NULL == _ENC) || (NULL == delta))
+		ret = RET_NOT_OK;
+	else{
+		moved = ENC_Read_Position(_ENC) - _ENC->reported_position;
+		detents = (sint16)(moved / _ENC->steps_per_detent);
+		_ENC->reported_position += (sint32)detents * _ENC->steps_per_detent;
+
+		if(ENC_ACCEL_ON == _ENC->acceleration){
+			speed = (_ENC->velocity < 0) ? -_ENC->velocity : _ENC->velocity;
+			factor = 1 + (speed / ENC_ACCEL_DIVISOR);
+			if(ENC_ACCEL_MAX < factor)
+				factor = ENC_ACCEL_MAX;
+			detents *= factor;
+		}
+		*delta = detents;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ENC_Update
+ * @brief 		- Updates the velocity estimation, to be called at a fixed rate
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Velocity is low-pass filtered (1/4 new sample)
+ */
+Std_Returntype ENC_Update(ENC_t *_ENC){
+	Std_Returntype ret = RET_OK;
+	sint32 position, moved;
+	sint16 sample;
+	if(NULL == _ENC)
+		ret = RET_NOT_OK;
+	else{
+		position = ENC_Read_Position(_ENC);
+		moved = position - _ENC->last_position;
+		if(moved > ENC_MOVED_MAX)
+			moved = ENC_MOVED_MAX;
+		else if(moved < -ENC_MOVED_MAX)
+			moved = -ENC_MOVED_MAX;
+		sample = (sint16)(moved * 16);
+		_ENC->last_position = position;
+		/* The difference of two sint16 values needs 17 bits */
+		_ENC->velocity += (sint16)(((sint32)sample - _ENC->velocity) / 4);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ENC_Get_Velocity
+ * @brief 		- Returns the filtered velocity
+ * @param [in] 	- _ENC: pointer to the encoder configuration
+ * @param [out] - velocity: pointer to the variable that will return transitions per ENC_Update period in Q4
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ENC_Get_Velocity(ENC_t *_ENC, sint16 *velocity){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _ENC) || (NULL == velocity))
+		ret = RET_NOT_OK;
+	else
+		*velocity = _ENC->velocity;
+	return ret;
+}
@@ -0,0 +1,96 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : FREQ_interface.h                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef HAL_FREQ_METER_FREQ_INTERFACE_H_
+#define HAL_FREQ_METER_FREQ_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/EXTI/EXTI_interface.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	/* Configuration, set by the user */
+	uint8			number;				// @ref EXTI_define
+	uint8			mode;				// @ref FREQ_MODE_define
+	uint32			timer_clock_hz;		// EXTI timebase clock (F_CPU / prescaler)
+	uint32			timeout_ticks;		// no edge for this long means the signal stopped (0: no timeout)
+	/* Runtime data, updated from the ISR */
+	volatile uint32	last_edge;
+	volatile uint32	last_rise;
+	volatile uint32	period_sum;
+	volatile uint32	period_count;
+	volatile uint32	high_ticks;
+	volatile uint32	low_ticks;
+	volatile uint32	edge_count;
+	volatile uint8	started;
+	uint32			gate_start;
+}FREQ_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref FREQ_MODE_define
+#define FREQ_MODE_PERIOD		0	/* rising edges, period and frequency */
+#define FREQ_MODE_PULSE_WIDTH	1	/* any change, also high/low time (INT0/INT1 only) */
+
+/*
+ * =============================================
+ * APIs Supported by "Frequency Meter"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- FREQ_Init
+ * @brief 		- Configures the EXTI line of the meter and starts measuring
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- EXTI_Timestamp_Init must be called first, one meter per EXTI line. The meter
+ * 				  subscribes to the line, other modules may share it if they use the same trigger.
+ * 				  Fails when the subscriber table of the line is full
+ */
+Std_Returntype FREQ_Init(FREQ_t *meter);
+
+/**=============================================
+ * @Fn			- FREQ_Get_Frequency
+ * @brief 		- Returns the frequency averaged over the periods since the previous call
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @param [out] - frequency_q8: pointer to the variable that will return the frequency in Hz, Q24.8
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Returns 0 after timeout_ticks without an edge, keeps the last value if no full period elapsed yet
+ */
+Std_Returntype FREQ_Get_Frequency(FREQ_t *meter, uint32 *frequency_q8);
+
+/**=============================================
+ * @Fn			- FREQ_Get_Pulse_Width
+ * @brief 		- Returns the last measured high and low times
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @param [out] - high_ticks: pointer to the variable that will return the high time in timebase ticks
+ * @param [out] - low_ticks: pointer to the variable that will return the low time in timebase ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Meter must be in FREQ_MODE_PULSE_WIDTH
+ */
+Std_Returntype FREQ_Get_Pulse_Width(FREQ_t *meter, uint32 *high_ticks, uint32 *low_ticks);
+
+/**=============================================
+ * @Fn			- FREQ_Read_Gate
+ * @brief 		- Returns the edges counted since the previous call and the elapsed gate time
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @param [out] - edges: pointer to the variable that will return the edge count
+ * @param [out] - elapsed_ticks: pointer to the variable that will return the gate time in timebase ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Counts both edges in FREQ_MODE_PULSE_WIDTH
+ */
+Std_Returntype FREQ_Read_Gate(FREQ_t *meter, uint32 *edges, uint32 *elapsed_ticks);
+
+#endif /* HAL_FREQ_METER_FREQ_INTERFACE_H_ */
@@ -0,0 +1,210 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : FREQ_program.c                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "FREQ_interface.h"
+#include "../../SERVICES/BIT_MATH.h"
+
+/* Meter attached to each EXTI line (INT0, INT1, INT2) */
+static FREQ_t *FREQ_Meters[3];
+
+static const pinCfg_t FREQ_Pins[3] = {
+		{GPIOD, GPIO_INPUT, GPIO_PIN_2, GPIO_STATE_LOW},
+		{GPIOD, GPIO_INPUT, GPIO_PIN_3, GPIO_STATE_LOW},
+		{GPIOB, GPIO_INPUT, GPIO_PIN_2, GPIO_STATE_LOW}
+};
+
+/* Edge handler, runs in the EXTI ISR with interrupts disabled. The level is sampled
+ * first and both reads are direct, so short pulses are still classified correctly */
+static inline void FREQ_Edge(uint8 line){
+	FREQ_t *meter = FREQ_Meters[line];
+	uint32 now, delta;
+	uint8 level = GPIO_STATE_HIGH;
+
+	if(FREQ_MODE_PULSE_WIDTH == meter->mode)
+		level = GET_BIT(FREQ_Pins[line].GPIOx->PIN, FREQ_Pins[line].pin);
+	now = TIMER_Read_Timebase();
+
+	delta = now - meter->last_edge;
+	meter->last_edge = now;
+	meter->edge_count++;
+
+	if(meter->started){
+		if(GPIO_STATE_HIGH == level){
+			/* Rising edge closes a period and, in pulse width mode, a low phase */
+			meter->period_sum += (now - meter->last_rise);
+			meter->period_count++;
+			meter->low_ticks = delta;
+		}
+		else
+			meter->high_ticks = delta;
+	}
+	if(GPIO_STATE_HIGH == level){
+		meter->last_rise = now;
+		meter->started = 1;
+	}
+}
+
+static void FREQ_INT0_Handler(void){ FREQ_Edge(0); }
+static void FREQ_INT1_Handler(void){ FREQ_Edge(1); }
+static void FREQ_INT2_Handler(void){ FREQ_Edge(2); }
+
+/**=============================================
+ * @Fn			- FREQ_Init
+ * @brief 		- Configures the EXTI line of the meter and starts measuring
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- EXTI_Timestamp_Init must be called first, one meter per EXTI line. The meter
+ * 				  subscribes to the line, other modules may share it if they use the same trigger.
+ * 				  Fails when the subscriber table of the line is full
+ */
+Std_Returntype FREQ_Init(FREQ_t *meter){
+	Std_Returntype ret = RET_OK;
+	EXTI_cfg line_cfg;
+	void (*pf_handler)(void) = NULL;
+	uint8 line, handle, sreg_state;
+	if((NULL == meter) || (0 == meter->timer_clock_hz))
+		ret = RET_NOT_OK;
+	else{
+		line_cfg.number = meter->number;
+		line_cfg.dispatch = EXTI_DISPATCH_CALLBACK;
+		line_cfg.mode = ((FREQ_MODE_PULSE_WIDTH == meter->mode) ? EXTI_TRIGGER_ANY_CHANGE : EXTI_TRIGGER_RISING_EDGE);
+		line_cfg.pf_CallBack = NULL;
+		switch(meter->number){
+		case EXTI_INT0: line = 0; pf_handler = FREQ_INT0_Handler; break;
+		case EXTI_INT1: line = 1; pf_handler = FREQ_INT1_Handler; break;
+		case EXTI_INT2: line = 2; pf_handler = FREQ_INT2_Handler; break;
+		default: line = 0; ret = RET_NOT_OK; break;
+		}
+		/* INT2 has no any change trigger */
+		if((2 == line) && (FREQ_MODE_PULSE_WIDTH == meter->mode))
+			ret = RET_NOT_OK;
+
+		if(RET_OK == ret){
+			meter->started = 0;
+			meter->period_sum = 0;
+			meter->period_count = 0;
+			meter->high_ticks = 0;
+			meter->low_ticks = 0;
+			meter->edge_count = 0;
+			EXTI_Get_Timestamp(&(meter->gate_start));
+			meter->last_edge = meter->gate_start;
+			/* The handler stays subscribed when a meter of the line is initialized again */
+			if(NULL == FREQ_Meters[line]){
+				FREQ_Meters[line] = meter;
+				ret = EXTI_Subscribe(meter->number, pf_handler, EXTI_PRIORITY_NORMAL, &handle);
+				if(RET_OK != ret)
+					FREQ_Meters[line] = NULL;
+			}
+			else{
+				sreg_state = SREG;
+				GLOBAL_INTERRUPT_DISABLE();
+				FREQ_Meters[line] = meter;
+				SREG = sreg_state;
+			}
+			if(RET_OK == ret)
+				ret |= EXTI_Init(&line_cfg);
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- FREQ_Get_Frequency
+ * @brief 		- Returns the frequency averaged over the periods since the previous call
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @param [out] - frequency_q8: pointer to the variable that will return the frequency in Hz, Q24.8
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Returns 0 after timeout_ticks without an edge, keeps the last value if no full period elapsed yet
+ */
+Std_Returntype FREQ_Get_Frequency(FREQ_t *meter, uint32 *frequency_q8){
+	Std_Returntype ret = RET_OK;
+	uint32 period_sum, period_count, last_edge, now;
+	uint8 sreg_state;
+	if((NULL == meter) || (NULL == frequency_q8))
+		ret = RET_NOT_OK;
+	else{
+		/* Take and reset the accumulated periods atomically */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		period_sum = meter->period_sum;
+		period_count = meter->period_count;
+		last_edge = meter->last_edge;
+		if(period_count){
+			meter->period_sum = 0;
+			meter->period_count = 0;
+		}
+		SREG = sreg_state;
+
+		EXTI_Get_Timestamp(&now);
+		if((0 != meter->timeout_ticks) && ((now - last_edge) > meter->timeout_ticks)){
+			/* Signal stopped, the next edge starts a new measurement */
+			meter->started = 0;
+			*frequency_q8 = 0;
+		}
+		else if(period_count && period_sum){
+			/* f = count * timer_clock / sum, 64-bit to keep full precision in Q8 */
+			*frequency_q8 = (uint32)((((uint64)meter->timer_clock_hz * period_count) << 8) / period_sum);
+		}
+		else{ /* No complete period yet, keep the previous value */ }
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- FREQ_Get_Pulse_Width
+ * @brief 		- Returns the last measured high and low times
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @param [out] - high_ticks: pointer to the variable that will return the high time in timebase ticks
+ * @param [out] - low_ticks: pointer to the variable that will return the low time in timebase ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Meter must be in FREQ_MODE_PULSE_WIDTH
+ */
+Std_Returntype FREQ_Get_Pulse_Width(FREQ_t *meter, uint32 *high_ticks, uint32 *low_ticks){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((NULL == meter) || (NULL == high_ticks) || (NULL == low_ticks) || (FREQ_MODE_PULSE_WIDTH != meter->mode))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		*high_ticks = meter->high_ticks;
+		*low_ticks = meter->low_ticks;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- FREQ_Read_Gate
+ * @brief 		- Returns the edges counted since the previous call and the elapsed gate time
+ * @param [in] 	- meter: pointer to the meter configuration
+ * @param [out] - edges: pointer to the variable that will return the edge count
+ * @param [out] - elapsed_ticks: pointer to the variable that will return the gate time in timebase ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Counts both edges in FREQ_MODE_PULSE_WIDTH
+ */
+Std_Returntype FREQ_Read_Gate(FREQ_t *meter, uint32 *edges, uint32 *elapsed_ticks){
+	Std_Returntype ret = RET_OK;
+	uint32 now;
+	uint8 sreg_state;
+	if((NULL == meter) || (NULL == edges) || (NULL == elapsed_ticks))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		EXTI_Get_Timestamp(&now);
+		*edges = meter->edge_count;
+		meter->edge_count = 0;
+		SREG = sreg_state;
+
+		*elapsed_ticks = now - meter->gate_start;
+		meter->gate_start = now;
+	}
+	return ret;
+}
@@ -0,0 +1,147 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : GEST_interface.h                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef HAL_GESTURE_GEST_INTERFACE_H_
+#define HAL_GESTURE_GEST_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../KEYPAD/keypad_interface.h"
+#include "../PB/PB_interface.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+/* Keys tracked at the same time */
+#define GEST_MAX_KEYS			4U
+
+/* Number of queued gesture events, must be a power of 2 */
+#define GEST_EVENT_QUEUE_SIZE	8U
+
+// @ref GEST_EVENT_define
+#define GEST_EVENT_CLICK			0
+#define GEST_EVENT_DOUBLE_CLICK		1
+#define GEST_EVENT_LONG_PRESS		2
+#define GEST_EVENT_REPEAT			3
+#define GEST_EVENT_CHORD			4	/* key2 is the key pressed first */
+
+// @ref GEST_INPUT_define
+#define GEST_INPUT_RELEASE			0
+#define GEST_INPUT_PRESS			1
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint8	type;		// @ref GEST_EVENT_define
+	uint8	key;
+	uint8	key2;		// second key of a chord
+	uint8	count;		// REPEAT events since the press
+}GEST_Event_t;
+
+typedef struct{
+	uint8	key;
+	uint8	state;
+	uint8	flags;
+	uint8	repeat_count;
+	uint16	press_time;
+	uint16	release_time;
+	uint16	next_repeat;
+	uint16	repeat_period;
+}GEST_Key_t;
+
+typedef struct{
+	/* Configuration in ticks of the caller's time base, set by the user */
+	uint16			double_gap;			// max release to press time of a double click (0: no double click)
+	uint16			long_press;			// hold time of LONG_PRESS (0: no long press)
+	uint16			repeat_delay;		// hold time of the first REPEAT (0: no repeat)
+	uint16			repeat_period;		// period of the second REPEAT
+	uint16			repeat_min_period;	// fastest REPEAT period
+	uint16			repeat_step;		// the period shrinks by this much after each REPEAT
+	uint16			chord_window;		// max time between the presses of a chord (0: no chords)
+	/* Runtime data */
+	GEST_Key_t		keys[GEST_MAX_KEYS];
+	GEST_Event_t	queue[GEST_EVENT_QUEUE_SIZE];
+	uint8			head;
+	uint8			tail;
+}GEST_t;
+
+/*
+ * =============================================
+ * APIs Supported by "Gesture"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- GEST_Init
+ * @brief 		- Clears the key table and the event queue
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Time values are free running uint16 ticks (e.g. ms), they may wrap
+ */
+Std_Returntype GEST_Init(GEST_t *gest);
+
+/**=============================================
+ * @Fn			- GEST_Input
+ * @brief 		- Feeds a timestamped press or release of a key
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- key: any key value (e.g. keypad key or button number)
+ * @param [in] 	- input: press or release @ref GEST_INPUT_define
+ * @param [in] 	- now: time of the input
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or GEST_MAX_KEYS keys are already tracked
+ * Note			- None
+ */
+Std_Returntype GEST_Input(GEST_t *gest, uint8 key, uint8 input, uint16 now);
+
+/**=============================================
+ * @Fn			- GEST_Input_Keypad
+ * @brief 		- Feeds an event returned by keypad_Get_Event
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- event: pointer to the keypad event
+ * @param [in] 	- now: time of the event
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Keypad REPEAT and GHOST events are ignored, the gesture layer repeats on its own
+ */
+Std_Returntype GEST_Input_Keypad(GEST_t *gest, const KPD_Event_t *event, uint16 now);
+
+/**=============================================
+ * @Fn			- GEST_Input_Level
+ * @brief 		- Feeds the current level of a key, a press or release is detected on change
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- key: any key value (e.g. button number)
+ * @param [in] 	- level: state returned by PB_Read @ref PB_STATE_define
+ * @param [in] 	- now: time of the sample
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Levels should be debounced
+ */
+Std_Returntype GEST_Input_Level(GEST_t *gest, uint8 key, uint8 level, uint16 now);
+
+/**=============================================
+ * @Fn			- GEST_Tick
+ * @brief 		- Emits the time based events (click timeout, long press, repeat)
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- now: current time
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Constant work per tracked key, call at least once per repeat period
+ */
+Std_Returntype GEST_Tick(GEST_t *gest, uint16 now);
+
+/**=============================================
+ * @Fn			- GEST_Get_Event
+ * @brief 		- Returns the oldest gesture event without blocking
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if the queue is empty
+ * Note			- None
+ */
+Std_Returntype GEST_Get_Event(GEST_t *gest, GEST_Event_t *event);
+
+#endif /* HAL_GESTURE_GEST_INTERFACE_H_ */
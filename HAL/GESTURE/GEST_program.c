@@ -0,0 +1,306 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : GEST_program.c                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "GEST_interface.h"
+
+/* Key table states */
+#define GEST_STATE_FREE		0
+#define GEST_STATE_DOWN		1
+#define GEST_STATE_UP_WAIT	2	/* released after a click, waiting for a double click */
+
+/* Key table flags */
+#define GEST_FLAG_SECOND	0x01	/* second press of a double click */
+#define GEST_FLAG_LONG		0x02
+#define GEST_FLAG_REPEATED	0x04
+#define GEST_FLAG_CHORD		0x08
+
+#define GEST_NO_KEY			0xFF
+
+/* A full queue drops the event */
+static void GEST_Push(GEST_t *gest, uint8 type, uint8 key, uint8 key2, uint8 count){
+	uint8 head = gest->head;
+	uint8 next_head = (head + 1) & (GEST_EVENT_QUEUE_SIZE - 1);
+	if(next_head != gest->tail){
+		gest->queue[head].type = type;
+		gest->queue[head].key = key;
+		gest->queue[head].key2 = key2;
+		gest->queue[head].count = count;
+		gest->head = next_head;
+	}
+}
+
+static uint8 GEST_Find(const GEST_t *gest, uint8 key){
+	uint8 index;
+	uint8 found = GEST_NO_KEY;
+	for(index = 0; index < GEST_MAX_KEYS; index++){
+		if((GEST_STATE_FREE != gest->keys[index].state) && (key == gest->keys[index].key))
+			found = index;
+	}
+	return found;
+}
+
+static uint8 GEST_Find_Free(const GEST_t *gest){
+	uint8 index;
+	uint8 found = GEST_NO_KEY;
+	for(index = 0; (index < GEST_MAX_KEYS) && (GEST_NO_KEY == found); index++){
+		if(GEST_STATE_FREE == gest->keys[index].state)
+			found = index;
+	}
+	return found;
+}
+
+/* The first click of a double click that turned into a hold is reported on its own */
+static void GEST_Hold_Started(GEST_t *gest, GEST_Key_t *slot){
+	if(slot->flags & GEST_FLAG_SECOND){
+		GEST_Push(gest, GEST_EVENT_CLICK, slot->key, GEST_NO_KEY, 0);
+		slot->flags &= ~GEST_FLAG_SECOND;
+	}
+}
+
+static void GEST_Press(GEST_t *gest, uint8 index, uint8 flags, uint16 now){
+	GEST_Key_t *slot = &(gest->keys[index]);
+	GEST_Key_t *other;
+	uint8 other_index;
+	slot->state = GEST_STATE_DOWN;
+	slot->flags = flags;
+	slot->press_time = now;
+	slot->repeat_count = 0;
+	slot->next_repeat = now + gest->repeat_delay;
+	slot->repeat_period = gest->repeat_period;
+
+	/* A second key going down shortly after a plain press makes a chord */
+	if((0 != gest->chord_window) && (0 == flags)){
+		for(other_index = 0; other_index < GEST_MAX_KEYS; other_index++){
+			other = &(gest->keys[other_index]);
+			if((other_index != index) && (GEST_STATE_DOWN == other->state) &&
+					(0 == (other->flags & (GEST_FLAG_LONG | GEST_FLAG_REPEATED | GEST_FLAG_CHORD))) &&
+					((uint16)(now - other->press_time) <= gest->chord_window)){
+				GEST_Push(gest, GEST_EVENT_CHORD, slot->key, other->key, 0);
+				other->flags |= GEST_FLAG_CHORD;
+				slot->flags |= GEST_FLAG_CHORD;
+				break;
+			}
+		}
+	}
+}
+
+/**=============================================
+ * @Fn			- GEST_Init
+ * @brief 		- Clears the key table and the event queue
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Time values are free running uint16 ticks (e.g. ms), they may wrap
+ */
+Std_Returntype GEST_Init(GEST_t *gest){
+	Std_Returntype ret = RET_OK;
+	uint8 index;
+	if((NULL == gest) || ((0 != gest->repeat_delay) && (0 == gest->repeat_period)) ||
+			(gest->repeat_delay > 0x7FFF) || (gest->repeat_period > 0x7FFF))
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < GEST_MAX_KEYS; index++)
+			gest->keys[index].state = GEST_STATE_FREE;
+		gest->head = 0;
+		gest->tail = 0;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- GEST_Input
+ * @brief 		- Feeds a timestamped press or release of a key
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- key: any key value (e.g. keypad key or button number)
+ * @param [in] 	- input: press or release @ref GEST_INPUT_define
+ * @param [in] 	- now: time of the input
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or GEST_MAX_KEYS keys are already tracked
+ * Note			- None
+ */
+Std_Returntype GEST_Input(GEST_t *gest, uint8 key, uint8 input, uint16 now){
+	Std_Returntype ret = RET_OK;
+	GEST_Key_t *slot;
+	uint8 index;
+	if(NULL == gest)
+		ret = RET_NOT_OK;
+	else{
+		index = GEST_Find(gest, key);
+		slot = (GEST_NO_KEY != index) ? &(gest->keys[index]) : NULL;
+		if(GEST_INPUT_PRESS == input){
+			if((NULL != slot) && (GEST_STATE_UP_WAIT == slot->state)){
+				if((uint16)(now - slot->release_time) <= gest->double_gap)
+					GEST_Press(gest, index, GEST_FLAG_SECOND, now);
+				else{
+					/* GEST_Tick did not run since the gap expired */
+					GEST_Push(gest, GEST_EVENT_CLICK, key, GEST_NO_KEY, 0);
+					GEST_Press(gest, index, 0, now);
+				}
+			}
+			else if(NULL != slot){
+				/* Already down */
+			}
+			else{
+				index = GEST_Find_Free(gest);
+				if(GEST_NO_KEY == index)
+					ret = RET_NOT_OK;
+				else{
+					gest->keys[index].key = key;
+					GEST_Press(gest, index, 0, now);
+				}
+			}
+		}
+		else if(GEST_INPUT_RELEASE == input){
+			if((NULL != slot) && (GEST_STATE_DOWN == slot->state)){
+				if(slot->flags & (GEST_FLAG_CHORD | GEST_FLAG_LONG | GEST_FLAG_REPEATED))
+					slot->state = GEST_STATE_FREE;
+				else if(slot->flags & GEST_FLAG_SECOND){
+					GEST_Push(gest, GEST_EVENT_DOUBLE_CLICK, key, GEST_NO_KEY, 0);
+					slot->state = GEST_STATE_FREE;
+				}
+				else if(0 == gest->double_gap){
+					GEST_Push(gest, GEST_EVENT_CLICK, key, GEST_NO_KEY, 0);
+					slot->state = GEST_STATE_FREE;
+				}
+				else{
+					slot->state = GEST_STATE_UP_WAIT;
+					slot->release_time = now;
+				}
+			}
+		}
+		else
+			ret = RET_NOT_OK;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- GEST_Input_Keypad
+ * @brief 		- Feeds an event returned by keypad_Get_Event
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- event: pointer to the keypad event
+ * @param [in] 	- now: time of the event
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Keypad REPEAT and GHOST events are ignored, the gesture layer repeats on its own
+ */
+Std_Returntype GEST_Input_Keypad(GEST_t *gest, const KPD_Event_t *event, uint16 now){
+	Std_Returntype ret = RET_OK;
+	if(NULL == event)
+		ret = RET_NOT_OK;
+	else if(KPD_EVENT_PRESS == event->type)
+		ret = GEST_Input(gest, event->key, GEST_INPUT_PRESS, now);
+	else if(KPD_EVENT_RELEASE == event->type)
+		ret = GEST_Input(gest, event->key, GEST_INPUT_RELEASE, now);
+	else{ /* Do Nothing */ }
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- GEST_Input_Level
+ * @brief 		- Feeds the current level of a key, a press or release is detected on change
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- key: any key value (e.g. button number)
+ * @param [in] 	- level: state returned by PB_Read @ref PB_STATE_define
+ * @param [in] 	- now: time of the sample
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Levels should be debounced
+ */
+Std_Returntype GEST_Input_Level(GEST_t *gest, uint8 key, uint8 level, uint16 now){
+	Std_Returntype ret = RET_OK;
+	uint8 index, down;
+	if(NULL == gest)
+		ret = RET_NOT_OK;
+	else{
+		index = GEST_Find(gest, key);
+		down = (GEST_NO_KEY != index) && (GEST_STATE_DOWN == gest->keys[index].state);
+		if((PB_PRESSED == level) && (!down))
+			ret = GEST_Input(gest, key, GEST_INPUT_PRESS, now);
+		else if((PB_RELEASED == level) && (down))
+			ret = GEST_Input(gest, key, GEST_INPUT_RELEASE, now);
+		else{ /* Do Nothing */ }
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- GEST_Tick
+ * @brief 		- Emits the time based events (click timeout, long press, repeat)
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [in] 	- now: current time
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Constant work per tracked key, call at least once per repeat period
+ */
+Std_Returntype GEST_Tick(GEST_t *gest, uint16 now){
+	Std_Returntype ret = RET_OK;
+	GEST_Key_t *slot;
+	uint8 index;
+	if(NULL == gest)
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < GEST_MAX_KEYS; index++){
+			slot = &(gest->keys[index]);
+			if((GEST_STATE_DOWN == slot->state) && (0 == (slot->flags & GEST_FLAG_CHORD))){
+				if((0 != gest->long_press) && (0 == (slot->flags & GEST_FLAG_LONG)) &&
+						((uint16)(now - slot->press_time) >= gest->long_press)){
+					GEST_Hold_Started(gest, slot);
+					GEST_Push(gest, GEST_EVENT_LONG_PRESS, slot->key, GEST_NO_KEY, 0);
+					slot->flags |= GEST_FLAG_LONG;
+				}
+				/* Signed difference, next_repeat is never more than 0x7FFF ticks ahead */
+				if((0 != gest->repeat_delay) && ((sint16)(now - slot->next_repeat) >= 0)){
+					GEST_Hold_Started(gest, slot);
+					if(0xFF != slot->repeat_count)
+						slot->repeat_count++;
+					GEST_Push(gest, GEST_EVENT_REPEAT, slot->key, GEST_NO_KEY, slot->repeat_count);
+					slot->flags |= GEST_FLAG_REPEATED;
+					slot->next_repeat += slot->repeat_period;
+					/* Accelerate down to the minimum period */
+					if(slot->repeat_period > (gest->repeat_min_period + gest->repeat_step))
+						slot->repeat_period -= gest->repeat_step;
+					else if(slot->repeat_period > gest->repeat_min_period)
+						slot->repeat_period = gest->repeat_min_period;
+					else{ /* Do Nothing */ }
+					if(0 == slot->repeat_period)
+						slot->repeat_period = 1;
+				}
+			}
+			else if((GEST_STATE_UP_WAIT == slot->state) &&
+					((uint16)(now - slot->release_time) > gest->double_gap)){
+				GEST_Push(gest, GEST_EVENT_CLICK, slot->key, GEST_NO_KEY, 0);
+				slot->state = GEST_STATE_FREE;
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- GEST_Get_Event
+ * @brief 		- Returns the oldest gesture event without blocking
+ * @param [in] 	- gest: pointer to the gesture configuration
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if the queue is empty
+ * Note			- None
+ */
+Std_Returntype GEST_Get_Event(GEST_t *gest, GEST_Event_t *event){
+	Std_Returntype ret = RET_OK;
+	uint8 tail;
+	if((NULL == gest) || (NULL == event))
+		ret = RET_NOT_OK;
+	else{
+		tail = gest->tail;
+		if(tail == gest->head)
+			ret = RET_NOT_OK;
+		else{
+			*event = gest->queue[tail];
+			gest->tail = (tail + 1) & (GEST_EVENT_QUEUE_SIZE - 1);
+		}
+	}
+	return ret;
+}
@@ -13,15 +13,46 @@
 // Section: Includes
 //----------------------------------------------
 #include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/EXTI/EXTI_interface.h"
 
 
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
+/* Capacity of KPD_t, override with -D for larger keypads (at most 8 each).
+ * Each instance uses rows x cols of it */
+#ifndef KEYPAD_ROWS
 #define KEYPAD_ROWS		4
+#endif
+#ifndef KEYPAD_COLS
 #define KEYPAD_COLS		4
+#endif
+/* Row states, columns and ghost flags are uint8 bitmaps */
+#if (KEYPAD_ROWS > 8) || (KEYPAD_COLS > 8)
+#error "KEYPAD_ROWS and KEYPAD_COLS must be at most 8"
+#endif
 
-// @ref Module_Ref_Name_define
+/* Number of queued key events, must be a power of 2 */
+#define KPD_EVENT_QUEUE_SIZE	8U
+
+// @ref KPD_EVENT_define
+#define KPD_EVENT_PRESS			0
+#define KPD_EVENT_RELEASE		1
+#define KPD_EVENT_REPEAT		2
+#define KPD_EVENT_GHOST			3	/* key = KPD_KEY_NONE, new presses are held back until a key is released */
+
+#define KPD_KEY_NONE			0xFF
+
+// @ref KPD_WAKE_define
+#define KPD_WAKE_OFF			0	/* scan on every tick */
+#define KPD_WAKE_EXTI			1	/* idle with all columns low until the wake line fires */
+
+// @ref KPD_STATE_define
+#define KPD_STATE_SCANNING		0
+#define KPD_STATE_IDLE			1
+
+/* row_shift value when the row pins are not consecutive */
+#define KPD_ROW_SHIFT_NONE		0xFF
 
 //----------------------------------------------
 // Section: User type definitions
@@ -29,8 +60,48 @@
 typedef struct{
 	pinCfg_t	row[KEYPAD_ROWS];
 	pinCfg_t	col[KEYPAD_COLS];
+	uint8		rows;		// rows in use, 0 for KEYPAD_ROWS
+	uint8		cols;		// columns in use, 0 for KEYPAD_COLS
+	const uint8	*keymap;	// rows x cols key values, row major (NULL for the default 4x4 map)
 }KPD_t;
 
+typedef struct{
+	uint8	type;	// @ref KPD_EVENT_define
+	uint8	key;	// value of the key
+}KPD_Event_t;
+
+typedef struct{
+	/* Configuration, set by the user */
+	const KPD_t		*cfg;
+	uint8			debounce_scans;		// equal samples of a column needed to accept a change
+	uint16			repeat_delay;		// ticks from PRESS to the first REPEAT (0: no repeat)
+	uint16			repeat_period;		// ticks between REPEAT events (0: a single REPEAT)
+	uint8			wake;				// @ref KPD_WAKE_define
+	EXTI_cfg		wake_exti;			// number and mode of the line tied to the rows (e.g. diode-OR)
+	/* Matrix size and port masks, computed by keypad_Scanner_Init when all rows share a port and all columns share a port */
+	uint8			rows;
+	uint8			cols;
+	uint8			fast;
+	GPIO_Typedef	*row_port;
+	GPIO_Typedef	*col_port;
+	uint8			col_mask;
+	uint8			col_bit[KEYPAD_COLS];
+	uint8			row_bit[KEYPAD_ROWS];
+	uint8			row_shift;			// rows on consecutive pins: rows = (~PIN >> row_shift)
+	/* Runtime data, updated by keypad_Scan_Tick */
+	volatile uint8	state;				// @ref KPD_STATE_define
+	uint8			column;
+	uint8			stable[KEYPAD_COLS];	// debounced rows bitmap of each column, 1 = pressed
+	uint8			sample[KEYPAD_COLS];
+	uint8			count[KEYPAD_COLS];
+	uint8			repeat_key;
+	uint16			repeat_timer;
+	volatile uint8	ghost;				// columns with presses held back by a ghost pattern
+	KPD_Event_t		queue[KPD_EVENT_QUEUE_SIZE];
+	volatile uint8	head;
+	volatile uint8	tail;
+}KPD_Scanner_t;
+
 
 /*
  * =============================================
@@ -57,4 +128,89 @@ Std_Returntype keypad_init(const KPD_t* KPD_cfg);
   */
 Std_Returntype keypad_Get_Pressed_Key(const KPD_t* KPD_cfg, uint8 *pressed_key);
 
+/**=============================================
+  * @Fn				- keypad_Scanner_Init
+  * @brief 			- Initializes the keypad and the state of a tick driven scanner
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- Drives the first column low, keypad_Scan_Tick reads it on the next tick.
+  * 				  If the rows are on one port and the columns on one port, the scanner uses
+  * 				  one masked PORT write per column and one PIN read for all rows.
+  * 				  With KPD_WAKE_EXTI it starts idle, only one scanner can use the wake mode.
+  * 				  If the wake line cannot be subscribed, wake is set to KPD_WAKE_OFF, the
+  * 				  scanner keeps scanning and RET_NOT_OK is returned
+  */
+Std_Returntype keypad_Scanner_Init(KPD_Scanner_t *scanner);
+
+/**=============================================
+  * @Fn				- keypad_Scan_Tick
+  * @brief 			- Reads one column, debounces it and moves to the next column
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- Call periodically (e.g. every 1-5 ms from a timer ISR), it never waits.
+  * 				  Debounce time = debounce_scans * cols ticks. Every key gets its own events
+  * 				  (n-key rollover) unless a ghost pattern is detected.
+  * 				  In KPD_STATE_IDLE it returns at once, the scanner goes idle again after
+  * 				  a full scan with all keys released
+  */
+Std_Returntype keypad_Scan_Tick(KPD_Scanner_t *scanner);
+
+/**=============================================
+  * @Fn				- keypad_Get_Event
+  * @brief 			- Returns the oldest key event without blocking
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- event: pointer to the variable that will return the event
+  * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if the queue is empty
+  * Note			- None
+  */
+Std_Returntype keypad_Get_Event(KPD_Scanner_t *scanner, KPD_Event_t *event);
+
+/**=============================================
+  * @Fn				- keypad_Scan_Matrix
+  * @brief 			- Scans all columns at once without debouncing
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- rows: array of cols rows bitmaps, 1 = pressed
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- The column of the tick scanner is driven low again before returning.
+  * 				  Other pins of the column port must not be written from an ISR meanwhile
+  */
+Std_Returntype keypad_Scan_Matrix(KPD_Scanner_t *scanner, uint8 *rows);
+
+/**=============================================
+  * @Fn				- keypad_Get_Matrix
+  * @brief 			- Returns the debounced state of the whole matrix
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- matrix: array of cols rows bitmaps, 1 = pressed
+  * @param [out] 	- ghost: pointer to the variable that will return 1 if a ghost pattern is present,
+  * 				  the keys of that pattern are not part of the matrix
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- None
+  */
+Std_Returntype keypad_Get_Matrix(KPD_Scanner_t *scanner, uint8 *matrix, uint8 *ghost);
+
+/**=============================================
+  * @Fn				- keypad_Get_Pressed_Keys
+  * @brief 			- Returns the values of all the debounced pressed keys
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- keys: array that will return the key values
+  * @param [in] 	- max_keys: size of the keys array
+  * @param [out] 	- count: pointer to the variable that will return the number of pressed keys
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * 				  or more than max_keys keys are pressed
+  * Note			- Keys are returned column by column, then row by row
+  */
+Std_Returntype keypad_Get_Pressed_Keys(KPD_Scanner_t *scanner, uint8 *keys, uint8 max_keys, uint8 *count);
+
+/**=============================================
+  * @Fn				- keypad_Sleep_While_Idle
+  * @brief 			- Puts the CPU to sleep until a key wakes the scanner
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [in] 	- sleep_mode: sleep mode to use @ref SLEEP_MODE_define
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- Requires KPD_WAKE_EXTI, returns at once if the scanner is not idle.
+  * 				  Below idle sleep, INT0/INT1 wake only on EXTI_TRIGGER_LOW_LEVEL and the
+  * 				  timer calling keypad_Scan_Tick must keep running or restart after waking
+  */
+Std_Returntype keypad_Sleep_While_Idle(KPD_Scanner_t *scanner, uint8 sleep_mode);
+
 #endif /* HAL_KEYPAD_KEYPAD_INTERFACE_H_ */
@@ -8,15 +8,162 @@
 /*************************************************************************/
 
 #include "keypad_interface.h"
+#include "../../SERVICES/BIT_MATH.h"
 
-/* Keypad buttons definition */
-static uint8 Keypad_Buttons [KEYPAD_ROWS][KEYPAD_COLS] = {
+/* Default keypad buttons definition, used when KPD_t has no keymap */
+static const uint8 Keypad_Buttons [4][4] = {
 		{ '7' ,  '8' ,  '9' , '/'},
 		{ '4' ,  '5' ,  '6' , 'x'},
 		{ '1' ,  '2' ,  '3' , '-'},
 		{ 'C' ,  '0' ,  '=' , '+'}
 };
 
+static inline uint8 keypad_Rows(const KPD_t *KPD_cfg){
+	return (KPD_cfg->rows) ? KPD_cfg->rows : KEYPAD_ROWS;
+}
+
+static inline uint8 keypad_Cols(const KPD_t *KPD_cfg){
+	return (KPD_cfg->cols) ? KPD_cfg->cols : KEYPAD_COLS;
+}
+
+static inline uint8 keypad_Key(const KPD_t *KPD_cfg, uint8 row, uint8 col){
+	uint8 key;
+	if(KPD_cfg->keymap)
+		key = KPD_cfg->keymap[(row * keypad_Cols(KPD_cfg)) + col];
+	else if((row < 4) && (col < 4))
+		key = Keypad_Buttons[row][col];
+	else
+		key = KPD_KEY_NONE;
+	return key;
+}
+
+/* Scanner using the wake mode, its line calls keypad_Wake_Handler */
+static KPD_Scanner_t *keypad_Wake_Scanner;
+static uint8 keypad_Wake_Handle;
+
+/* Two columns sharing two or more pressed rows make a rectangle whose fourth corner
+ * reads pressed whether it is or not. Checks column col with the rows bitmap rows */
+static uint8 keypad_Is_Ghost(const KPD_Scanner_t *scanner, uint8 col, uint8 rows){
+	uint8 col_iterator, common;
+	uint8 ghost = 0;
+	for(col_iterator = 0; col_iterator < scanner->cols; col_iterator++){
+		if(col_iterator != col){
+			common = rows & scanner->stable[col_iterator];
+			/* More than one bit set */
+			if(common & (common - 1))
+				ghost = 1;
+		}
+	}
+	return ghost;
+}
+
+/* Called from keypad_Scan_Tick only, a full queue drops the event */
+static void keypad_Push_Event(KPD_Scanner_t *scanner, uint8 type, uint8 key){
+	uint8 head = scanner->head;
+	uint8 next_head = (head + 1) & (KPD_EVENT_QUEUE_SIZE - 1);
+	if(next_head != scanner->tail){
+		scanner->queue[head].type = type;
+		scanner->queue[head].key = key;
+		scanner->head = next_head;
+	}
+}
+
+/* Fills the port masks of the fast path, leaves fast = 0 if the pins are spread over ports */
+static void keypad_Prepare_Fast(KPD_Scanner_t *scanner){
+	const KPD_t *KPD_cfg = scanner->cfg;
+	uint8 iterator;
+	uint8 fast = 1;
+	scanner->row_port = KPD_cfg->row[0].GPIOx;
+	scanner->col_port = KPD_cfg->col[0].GPIOx;
+	scanner->col_mask = 0;
+	scanner->row_shift = KPD_cfg->row[0].pin;
+	for(iterator = 0; iterator < scanner->rows; iterator++){
+		if(KPD_cfg->row[iterator].GPIOx != scanner->row_port)
+			fast = 0;
+		if(KPD_cfg->row[iterator].pin != (KPD_cfg->row[0].pin + iterator))
+			scanner->row_shift = KPD_ROW_SHIFT_NONE;
+		scanner->row_bit[iterator] = (1U << KPD_cfg->row[iterator].pin);
+	}
+	for(iterator = 0; iterator < scanner->cols; iterator++){
+		if(KPD_cfg->col[iterator].GPIOx != scanner->col_port)
+			fast = 0;
+		scanner->col_bit[iterator] = (1U << KPD_cfg->col[iterator].pin);
+		scanner->col_mask |= scanner->col_bit[iterator];
+	}
+	scanner->fast = fast;
+}
+
+/* Releases the driven column and drives col low */
+static inline void keypad_Drive_Column(KPD_Scanner_t *scanner, uint8 col){
+	uint8 iterator;
+	if(scanner->fast)
+		scanner->col_port->PORT = (scanner->col_port->PORT | scanner->col_mask) & ~(scanner->col_bit[col]);
+	else{
+		for(iterator = 0; iterator < scanner->cols; iterator++)
+			GPIO_PIN_Write(&(scanner->cfg->col[iterator]), (iterator == col) ? GPIO_STATE_LOW : GPIO_STATE_HIGH);
+	}
+}
+
+/* Drives all columns low so any key pulls its row, and the wake line, low */
+static inline void keypad_Drive_All_Columns(KPD_Scanner_t *scanner){
+	uint8 iterator;
+	if(scanner->fast)
+		scanner->col_port->PORT &= ~(scanner->col_mask);
+	else{
+		for(iterator = 0; iterator < scanner->cols; iterator++)
+			GPIO_PIN_Write(&(scanner->cfg->col[iterator]), GPIO_STATE_LOW);
+	}
+}
+
+/* Returns the rows bitmap of the column driven low, 1 = pressed */
+static inline uint8 keypad_Read_Rows(KPD_Scanner_t *scanner){
+	uint8 row_iterator, pin_state;
+	uint8 rows = 0;
+	if(scanner->fast){
+		pin_state = ~(scanner->row_port->PIN);
+		if(KPD_ROW_SHIFT_NONE != scanner->row_shift)
+			rows = (pin_state >> scanner->row_shift) & ((1U << scanner->rows) - 1);
+		else{
+			for(row_iterator = 0; row_iterator < scanner->rows; row_iterator++){
+				if(pin_state & scanner->row_bit[row_iterator])
+					SET_BIT(rows, row_iterator);
+			}
+		}
+	}
+	else{
+		for(row_iterator = 0; row_iterator < scanner->rows; row_iterator++){
+			GPIO_PIN_Read(&(scanner->cfg->row[row_iterator]), &pin_state);
+			if(GPIO_STATE_LOW == pin_state)
+				SET_BIT(rows, row_iterator);
+		}
+	}
+	return rows;
+}
+
+/* Wake line ISR: stops the line and starts scanning from the first column */
+static void keypad_Wake_Handler(void){
+	KPD_Scanner_t *scanner = keypad_Wake_Scanner;
+	EXTI_DeInit(scanner->wake_exti.number);
+	scanner->column = 0;
+	keypad_Drive_Column(scanner, 0);
+	scanner->state = KPD_STATE_SCANNING;
+}
+
+/* Parks all columns low and re-arms the wake line */
+static void keypad_Enter_Idle(KPD_Scanner_t *scanner){
+	keypad_Drive_All_Columns(scanner);
+	scanner->state = KPD_STATE_IDLE;
+	EXTI_Enable(scanner->wake_exti.number);
+	/* A key pressed before the line was re-armed had its request cleared, scan again */
+	CPU_NOP();
+	if(0 != keypad_Read_Rows(scanner)){
+		EXTI_DeInit(scanner->wake_exti.number);
+		scanner->column = 0;
+		keypad_Drive_Column(scanner, 0);
+		scanner->state = KPD_STATE_SCANNING;
+	}
+}
+
 /**=============================================
   * @Fn				- keypad_init
   * @brief 			- Initializes the keypad
@@ -27,13 +174,13 @@ static uint8 Keypad_Buttons [KEYPAD_ROWS][KEYPAD_COLS] = {
 Std_Returntype keypad_init(const KPD_t* KPD_cfg){
 	Std_Returntype ret = RET_OK;
 	uint8 iterator;
-	if(NULL == KPD_cfg)
+	if((NULL == KPD_cfg) || (KEYPAD_ROWS < keypad_Rows(KPD_cfg)) || (KEYPAD_COLS < keypad_Cols(KPD_cfg)))
 		ret = RET_NOT_OK;
 	else{
-		for(iterator = 0; iterator < KEYPAD_ROWS; iterator++)
+		for(iterator = 0; iterator < keypad_Rows(KPD_cfg); iterator++)
 			ret |= GPIO_PIN_Init(&(KPD_cfg->row[iterator]));
 
-		for(iterator = 0; iterator < KEYPAD_COLS; iterator++)
+		for(iterator = 0; iterator < keypad_Cols(KPD_cfg); iterator++)
 			ret |= GPIO_PIN_Init(&(KPD_cfg->col[iterator]));
 	}
 	return ret;
@@ -55,15 +202,15 @@ Std_Returntype keypad_Get_Pressed_Key(const KPD_t* KPD_cfg, uint8 *pressed_key){
 	if(NULL == KPD_cfg)
 		ret = RET_NOT_OK;
 	else{
-		for(col_iterator = 0; col_iterator < KEYPAD_COLS; col_iterator++){
+		for(col_iterator = 0; col_iterator < keypad_Cols(KPD_cfg); col_iterator++){
 			ret |= GPIO_PIN_Write(&(KPD_cfg->col[col_iterator]), GPIO_STATE_LOW);
 
-			for(row_iterator = 0; row_iterator < KEYPAD_ROWS; row_iterator++){
+			for(row_iterator = 0; row_iterator < keypad_Rows(KPD_cfg); row_iterator++){
 				GPIO_PIN_Read(&(KPD_cfg->row[row_iterator]), &pin_state);
 				if(GPIO_STATE_LOW == pin_state){
 					while(GPIO_STATE_LOW == pin_state)
 						GPIO_PIN_Read(&(KPD_cfg->row[row_iterator]), &pin_state);
-					*pressed_key = Keypad_Buttons[row_iterator][col_iterator];
+					*pressed_key = keypad_Key(KPD_cfg, row_iterator, col_iterator);
 					found_flag = 1;
 					break;
 				}
@@ -75,3 +222,307 @@ Std_Returntype keypad_Get_Pressed_Key(const KPD_t* KPD_cfg, uint8 *pressed_key){
 	}
 	return ret;
 }
+
+/**=============================================
+  * @Fn				- keypad_Scanner_Init
+  * @brief 			- Initializes the keypad and the state of a tick driven scanner
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- Drives the first column low, keypad_Scan_Tick reads it on the next tick.
+  * 				  If the rows are on one port and the columns on one port, the scanner uses
+  * 				  one masked PORT write per column and one PIN read for all rows.
+  * 				  With KPD_WAKE_EXTI it starts idle, only one scanner can use the wake mode.
+  * 				  If the wake line cannot be subscribed, wake is set to KPD_WAKE_OFF, the
+  * 				  scanner keeps scanning and RET_NOT_OK is returned
+  */
+Std_Returntype keypad_Scanner_Init(KPD_Scanner_t *scanner){
+	Std_Returntype ret = RET_OK;
+	EXTI_cfg line_cfg;
+	uint8 col_iterator, handle, sreg_state;
+	if((NULL == scanner) || (NULL == scanner->cfg) || (RET_OK != keypad_init(scanner->cfg)))
+		ret = RET_NOT_OK;
+	else{
+		scanner->rows = keypad_Rows(scanner->cfg);
+		scanner->cols = keypad_Cols(scanner->cfg);
+		keypad_Prepare_Fast(scanner);
+		for(col_iterator = 0; col_iterator < KEYPAD_COLS; col_iterator++){
+			scanner->stable[col_iterator] = 0;
+			scanner->sample[col_iterator] = 0;
+			scanner->count[col_iterator] = 0;
+		}
+		scanner->repeat_key = KPD_KEY_NONE;
+		scanner->repeat_timer = 0;
+		scanner->ghost = 0;
+		scanner->head = 0;
+		scanner->tail = 0;
+		scanner->column = 0;
+		scanner->state = KPD_STATE_SCANNING;
+		if(KPD_WAKE_EXTI == scanner->wake){
+			if(NULL != keypad_Wake_Scanner){
+				EXTI_Unsubscribe(keypad_Wake_Scanner->wake_exti.number, keypad_Wake_Handle);
+				keypad_Wake_Scanner = NULL;
+			}
+			line_cfg.number = scanner->wake_exti.number;
+			line_cfg.mode = scanner->wake_exti.mode;
+			line_cfg.dispatch = EXTI_DISPATCH_CALLBACK;
+			line_cfg.pf_CallBack = NULL;
+			/* The handler may run as soon as it is subscribed, so the scanner is set with it */
+			sreg_state = SREG;
+			GLOBAL_INTERRUPT_DISABLE();
+			ret = EXTI_Subscribe(line_cfg.number, keypad_Wake_Handler, EXTI_PRIORITY_HIGHEST, &handle);
+			if(RET_OK == ret){
+				keypad_Wake_Scanner = scanner;
+				keypad_Wake_Handle = handle;
+			}
+			else
+				scanner->wake = KPD_WAKE_OFF;
+			SREG = sreg_state;
+		}
+		if((KPD_WAKE_EXTI == scanner->wake) && (scanner == keypad_Wake_Scanner)){
+			/* Configure the line stopped, keypad_Enter_Idle arms it */
+			ret |= EXTI_Init(&line_cfg);
+			ret |= EXTI_DeInit(line_cfg.number);
+			keypad_Enter_Idle(scanner);
+		}
+		else
+			keypad_Drive_Column(scanner, 0);
+	}
+	return ret;
+}
+
+/**=============================================
+  * @Fn				- keypad_Scan_Tick
+  * @brief 			- Reads one column, debounces it and moves to the next column
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- Call periodically (e.g. every 1-5 ms from a timer ISR), it never waits.
+  * 				  Debounce time = debounce_scans * cols ticks. Every key gets its own events
+  * 				  (n-key rollover) unless a ghost pattern is detected.
+  * 				  In KPD_STATE_IDLE it returns at once, the scanner goes idle again after
+  * 				  a full scan with all keys released
+  */
+Std_Returntype keypad_Scan_Tick(KPD_Scanner_t *scanner){
+	Std_Returntype ret = RET_OK;
+	uint8 col, rows, changed, row_iterator, col_iterator, key, active;
+	if((NULL == scanner) || (NULL == scanner->cfg))
+		ret = RET_NOT_OK;
+	else if(KPD_STATE_IDLE == scanner->state){
+		/* Nothing to do until the wake line fires */
+	}
+	else{
+		col = scanner->column;
+		/* The column was driven low on the previous tick, so the rows had a full tick to settle */
+		rows = keypad_Read_Rows(scanner);
+
+		/* A change is accepted once the column read the same for debounce_scans scans */
+		if(rows != scanner->sample[col]){
+			scanner->sample[col] = rows;
+			scanner->count[col] = 0;
+		}
+		else if(scanner->count[col] < scanner->debounce_scans)
+			scanner->count[col]++;
+		if((scanner->count[col] >= scanner->debounce_scans) && (rows == scanner->stable[col]))
+			CLR_BIT(scanner->ghost, col);
+		else if(scanner->count[col] >= scanner->debounce_scans){
+			if(keypad_Is_Ghost(scanner, col, rows)){
+				/* Only releases are trusted, the new presses wait until the pattern is gone */
+				if(0 == scanner->ghost)
+					keypad_Push_Event(scanner, KPD_EVENT_GHOST, KPD_KEY_NONE);
+				SET_BIT(scanner->ghost, col);
+				rows &= scanner->stable[col];
+			}
+			else
+				CLR_BIT(scanner->ghost, col);
+			changed = rows ^ scanner->stable[col];
+			scanner->stable[col] = rows;
+			for(row_iterator = 0; row_iterator < scanner->rows; row_iterator++){
+				if(GET_BIT(changed, row_iterator)){
+					key = keypad_Key(scanner->cfg, row_iterator, col);
+					if(GET_BIT(rows, row_iterator)){
+						keypad_Push_Event(scanner, KPD_EVENT_PRESS, key);
+						/* The last pressed key is the one that repeats */
+						scanner->repeat_key = key;
+						scanner->repeat_timer = scanner->repeat_delay;
+					}
+					else{
+						keypad_Push_Event(scanner, KPD_EVENT_RELEASE, key);
+						if(key == scanner->repeat_key)
+							scanner->repeat_key = KPD_KEY_NONE;
+					}
+				}
+			}
+		}
+
+		if((KPD_KEY_NONE != scanner->repeat_key) && (0 != scanner->repeat_delay)){
+			if(scanner->repeat_timer > 1)
+				scanner->repeat_timer--;
+			else{
+				keypad_Push_Event(scanner, KPD_EVENT_REPEAT, scanner->repeat_key);
+				scanner->repeat_timer = scanner->repeat_period;
+				/* A timer of 0 would repeat on every tick */
+				if(0 == scanner->repeat_period)
+					scanner->repeat_key = KPD_KEY_NONE;
+			}
+		}
+
+		col = (col + 1 < scanner->cols) ? (col + 1) : 0;
+		scanner->column = col;
+		active = 1;
+		if((KPD_WAKE_EXTI == scanner->wake) && (0 == col) && (KPD_KEY_NONE == scanner->repeat_key)){
+			/* Idle again once a whole scan found every key released and settled */
+			active = 0;
+			for(col_iterator = 0; col_iterator < scanner->cols; col_iterator++)
+				active |= scanner->stable[col_iterator] | scanner->sample[col_iterator];
+		}
+		if(active)
+			keypad_Drive_Column(scanner, col);
+		else
+			keypad_Enter_Idle(scanner);
+	}
+	return ret;
+}
+
+/**=============================================
+  * @Fn				- keypad_Get_Event
+  * @brief 			- Returns the oldest key event without blocking
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- event: pointer to the variable that will return the event
+  * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if the queue is empty
+  * Note			- None
+  */
+Std_Returntype keypad_Get_Event(KPD_Scanner_t *scanner, KPD_Event_t *event){
+	Std_Returntype ret = RET_OK;
+	uint8 tail;
+	if((NULL == scanner) || (NULL == event))
+		ret = RET_NOT_OK;
+	else{
+		tail = scanner->tail;
+		if(tail == scanner->head)
+			ret = RET_NOT_OK;
+		else{
+			*event = scanner->queue[tail];
+			scanner->tail = (tail + 1) & (KPD_EVENT_QUEUE_SIZE - 1);
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+  * @Fn				- keypad_Scan_Matrix
+  * @brief 			- Scans all columns at once without debouncing
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- rows: array of cols rows bitmaps, 1 = pressed
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- The column of the tick scanner is driven low again before returning.
+  * 				  Other pins of the column port must not be written from an ISR meanwhile
+  */
+Std_Returntype keypad_Scan_Matrix(KPD_Scanner_t *scanner, uint8 *rows){
+	Std_Returntype ret = RET_OK;
+	uint8 col_iterator;
+	if((NULL == scanner) || (NULL == scanner->cfg) || (NULL == rows))
+		ret = RET_NOT_OK;
+	else{
+		for(col_iterator = 0; col_iterator < scanner->cols; col_iterator++){
+			keypad_Drive_Column(scanner, col_iterator);
+			/* PIN is read through a synchronizer, wait for the new column level to reach it */
+			CPU_NOP();
+			rows[col_iterator] = keypad_Read_Rows(scanner);
+		}
+		keypad_Drive_Column(scanner, scanner->column);
+	}
+	return ret;
+}
+
+/**=============================================
+  * @Fn				- keypad_Get_Matrix
+  * @brief 			- Returns the debounced state of the whole matrix
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- matrix: array of cols rows bitmaps, 1 = pressed
+  * @param [out] 	- ghost: pointer to the variable that will return 1 if a ghost pattern is present,
+  * 				  the keys of that pattern are not part of the matrix
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- None
+  */
+Std_Returntype keypad_Get_Matrix(KPD_Scanner_t *scanner, uint8 *matrix, uint8 *ghost){
+	Std_Returntype ret = RET_OK;
+	uint8 col_iterator, sreg_state;
+	if((NULL == scanner) || (NULL == matrix) || (NULL == ghost))
+		ret = RET_NOT_OK;
+	else{
+		/* Copy a consistent snapshot in case keypad_Scan_Tick runs from an ISR */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		for(col_iterator = 0; col_iterator < scanner->cols; col_iterator++)
+			matrix[col_iterator] = scanner->stable[col_iterator];
+		*ghost = (0 != scanner->ghost);
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+  * @Fn				- keypad_Get_Pressed_Keys
+  * @brief 			- Returns the values of all the debounced pressed keys
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [out] 	- keys: array that will return the key values
+  * @param [in] 	- max_keys: size of the keys array
+  * @param [out] 	- count: pointer to the variable that will return the number of pressed keys
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * 				  or more than max_keys keys are pressed
+  * Note			- Keys are returned column by column, then row by row
+  */
+Std_Returntype keypad_Get_Pressed_Keys(KPD_Scanner_t *scanner, uint8 *keys, uint8 max_keys, uint8 *count){
+	Std_Returntype ret = RET_OK;
+	uint8 matrix[KEYPAD_COLS];
+	uint8 row_iterator, col_iterator, ghost;
+	uint8 found = 0;
+	if((NULL == keys) || (NULL == count))
+		ret = RET_NOT_OK;
+	else{
+		ret |= keypad_Get_Matrix(scanner, matrix, &ghost);
+		if(RET_OK == ret){
+			for(col_iterator = 0; col_iterator < scanner->cols; col_iterator++){
+				for(row_iterator = 0; row_iterator < scanner->rows; row_iterator++){
+					if(GET_BIT(matrix[col_iterator], row_iterator)){
+						if(found < max_keys)
+							keys[found] = keypad_Key(scanner->cfg, row_iterator, col_iterator);
+						else
+							ret = RET_NOT_OK;
+						found++;
+					}
+				}
+			}
+		}
+		*count = (found < max_keys) ? found : max_keys;
+	}
+	return ret;
+}
+
+/**=============================================
+  * @Fn				- keypad_Sleep_While_Idle
+  * @brief 			- Puts the CPU to sleep until a key wakes the scanner
+  * @param [in] 	- scanner: pointer to the scanner configuration
+  * @param [in] 	- sleep_mode: sleep mode to use @ref SLEEP_MODE_define
+  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+  * Note			- Requires KPD_WAKE_EXTI, returns at once if the scanner is not idle.
+  * 				  Below idle sleep, INT0/INT1 wake only on EXTI_TRIGGER_LOW_LEVEL and the
+  * 				  timer calling keypad_Scan_Tick must keep running or restart after waking
+  */
+Std_Returntype keypad_Sleep_While_Idle(KPD_Scanner_t *scanner, uint8 sleep_mode){
+	Std_Returntype ret = RET_OK;
+	if((NULL == scanner) || (KPD_WAKE_EXTI != scanner->wake))
+		ret = RET_NOT_OK;
+	else{
+		EXTI->MCUCR.SM = sleep_mode;
+		EXTI->MCUCR.SE = 1;
+		GLOBAL_INTERRUPT_DISABLE();
+		/* Other interrupts wake the CPU too, sleep again while no key is down */
+		while(KPD_STATE_IDLE == scanner->state){
+			CPU_ENABLE_INTERRUPT_AND_SLEEP();
+			GLOBAL_INTERRUPT_DISABLE();
+		}
+		GLOBAL_INTERRUPT_ENABLE();
+		EXTI->MCUCR.SE = 0;
+	}
+	return ret;
+}
@@ -14,6 +14,21 @@
 //----------------------------------------------
 #include "../../MCAL/GPIO/GPIO_interface.h"
 
+//----------------------------------------------
+// Section: Macros Configuration
+//----------------------------------------------
+
+/* Capacity of LED_BAM_t */
+#define LED_BAM_MAX_LEDS	24
+#define LED_BAM_MAX_PORTS	4
+
+/* Duty resolution, one bit plane per bit */
+#define LED_BAM_BITS		8
+
+/* Capacity of LED_SEQ_t, and pattern priorities per LED (0 is the lowest) */
+#define LED_SEQ_MAX_LEDS	8
+#define LED_SEQ_PRIORITIES	2
+
 //----------------------------------------------
 // Section: User type definitions
 //----------------------------------------------
@@ -22,6 +37,46 @@ typedef struct{
 	uint8 	 led_mode; // @ref LED_MODE_define
 }LED_t;
 
+typedef struct{
+	/* Configuration, set by the user */
+	const LED_t		*leds;		// array of LEDs, any pins
+	uint8			count;		// at most LED_BAM_MAX_LEDS
+	/* Runtime data */
+	uint8			duty[LED_BAM_MAX_LEDS];
+	GPIO_Typedef	*port[LED_BAM_MAX_PORTS];
+	uint8			port_mask[LED_BAM_MAX_PORTS];
+	uint8			port_count;
+	uint8			plane[2][LED_BAM_BITS][LED_BAM_MAX_PORTS];	// port images of each bit, double buffered
+	volatile uint8	active;			// buffer output by LED_BAM_Tick
+	volatile uint8	swap_pending;	// the other buffer is ready, swapped at the start of a frame
+	uint8			bit;			// bit plane output by the next LED_BAM_Tick
+}LED_BAM_t;
+
+/* Pattern step, patterns are arrays of steps in flash ended by LED_SEQ_LOOP or LED_SEQ_END */
+typedef struct{
+	uint8	level;		// 0 = off, 255 = on, in between needs a BAM engine
+	uint8	ticks;		// duration, bit 7 set = ramp from the previous level (see LED_SEQ_RAMP)
+}LED_Step_t;
+
+typedef struct{
+	const LED_Step_t	*pattern;	// NULL when the slot is free
+	uint8				step;
+	uint8				elapsed;
+	uint8				from_level;
+	uint8				level;
+}LED_Slot_t;
+
+typedef struct{
+	/* Configuration, set by the user */
+	const LED_t		*leds;		// array of LEDs (the BAM leds when bam is used)
+	uint8			count;		// at most LED_SEQ_MAX_LEDS
+	LED_BAM_t		*bam;		// dimming engine for levels, NULL for on/off only
+	/* Runtime data, updated by LED_SEQ_Tick */
+	LED_Slot_t		slot[LED_SEQ_MAX_LEDS][LED_SEQ_PRIORITIES];
+	uint8			output[LED_SEQ_MAX_LEDS];
+	uint8			update_pending;		// BAM duties changed but not published yet
+}LED_SEQ_t;
+
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
@@ -30,6 +85,25 @@ typedef struct{
 #define LED_MODE_ActiveLow	0
 #define LED_MODE_ActiveHigh	1
 
+/* Pattern steps, ticks 1 -> 127 */
+#define LED_SEQ_STEP(level, ticks)		{(level), (ticks)}
+#define LED_SEQ_RAMP(level, ticks)		{(level), (0x80 | (ticks))}
+#define LED_SEQ_LOOP					{1, 0}	/* restart the pattern */
+#define LED_SEQ_END						{0, 0}	/* one-shot, the slot is freed */
+
+#define LED_SEQ_LEVEL_OFF				0
+#define LED_SEQ_LEVEL_ON				255
+
+// @ref LED_SEQ_PRIORITY_define
+#define LED_SEQ_PRIORITY_STATUS			0
+#define LED_SEQ_PRIORITY_ALERT			1
+
+/* Patterns in flash, for a 10 ms tick */
+extern const LED_Step_t LED_Pattern_Blink[];		/* 0.5 s on, 0.5 s off */
+extern const LED_Step_t LED_Pattern_Heartbeat[];	/* two short pulses per 1.2 s */
+extern const LED_Step_t LED_Pattern_Breathe[];		/* 2 s fade in and out, needs a BAM engine */
+extern const LED_Step_t LED_Pattern_Error[];		/* 3 fast blinks, one-shot */
+
 /*
  * =============================================
  * APIs Supported by "LED"
@@ -72,5 +146,91 @@ Std_Returntype LED_TurnOff(const LED_t* _LED);
  */
 Std_Returntype LED_Toggle(const LED_t* _LED);
 
+/**=============================================
+ * @Fn			- LED_BAM_Init
+ * @brief 		- Initializes the LEDs of a bit angle modulation engine, all off
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- LEDs may be spread over up to LED_BAM_MAX_PORTS ports
+ */
+Std_Returntype LED_BAM_Init(LED_BAM_t *_BAM);
+
+/**=============================================
+ * @Fn			- LED_BAM_Set
+ * @brief 		- Sets the brightness of one LED
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @param [in] 	- index: LED index in the leds array
+ * @param [in] 	- duty: brightness, 0 = off, 255 = on
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Takes effect after LED_BAM_Update
+ */
+Std_Returntype LED_BAM_Set(LED_BAM_t *_BAM, uint8 index, uint8 duty);
+
+/**=============================================
+ * @Fn			- LED_BAM_Update
+ * @brief 		- Converts the duty values to bit plane port images
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or the previous update is not shown yet (call again later, no value is lost)
+ * Note			- The new images are shown from the start of the next frame, LED_MODE_ActiveLow
+ * 				  is applied here
+ */
+Std_Returntype LED_BAM_Update(LED_BAM_t *_BAM);
+
+/**=============================================
+ * @Fn			- LED_BAM_Tick
+ * @brief 		- Outputs the next bit plane, one masked write per port
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @param [out] - next_shift: pointer to the variable that will return the weight of the plane just
+ * 				  output, the next interrupt must come after (base period << next_shift)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call from a timer compare ISR and reload the compare period from next_shift.
+ * 				  Frame = 255 base periods, keep it under ~10 ms to avoid flicker
+ */
+Std_Returntype LED_BAM_Tick(LED_BAM_t *_BAM, uint8 *next_shift);
+
+/**=============================================
+ * @Fn			- LED_SEQ_Init
+ * @brief 		- Initializes a pattern sequencer with all LEDs off and no pattern
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The LEDs (or the BAM engine) must be initialized first
+ */
+Std_Returntype LED_SEQ_Init(LED_SEQ_t *_SEQ);
+
+/**=============================================
+ * @Fn			- LED_SEQ_Play
+ * @brief 		- Starts a pattern on one LED at a priority
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @param [in] 	- index: LED index in the leds array
+ * @param [in] 	- pattern: steps in flash ended by LED_SEQ_LOOP or LED_SEQ_END
+ * @param [in] 	- priority: slot of the pattern @ref LED_SEQ_PRIORITY_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The highest playing priority drives the LED, a lower pattern keeps running
+ * 				  underneath and shows again when the higher one ends
+ */
+Std_Returntype LED_SEQ_Play(LED_SEQ_t *_SEQ, uint8 index, const LED_Step_t *pattern, uint8 priority);
+
+/**=============================================
+ * @Fn			- LED_SEQ_Stop
+ * @brief 		- Stops the pattern of one LED at a priority
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @param [in] 	- index: LED index in the leds array
+ * @param [in] 	- priority: slot of the pattern @ref LED_SEQ_PRIORITY_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype LED_SEQ_Stop(LED_SEQ_t *_SEQ, uint8 index, uint8 priority);
+
+/**=============================================
+ * @Fn			- LED_SEQ_Tick
+ * @brief 		- Advances the pattern of every LED by one tick
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call periodically (e.g. every 10 ms), LEDs are written only when their level
+ * 				  changes. With a BAM engine the images are updated at most once per tick
+ */
+Std_Returntype LED_SEQ_Tick(LED_SEQ_t *_SEQ);
+
 
 #endif /* HAL_LED_LED_INTERFACE_H_ */
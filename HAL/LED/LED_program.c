@@ -8,6 +8,60 @@
 /*************************************************************************/
 
 #include "LED_interface.h"
+#include <avr/pgmspace.h>
+
+#define LED_SEQ_RAMP_FLAG	0x80
+#define LED_SEQ_TICKS_MASK	0x7F
+
+const LED_Step_t LED_Pattern_Blink[] PROGMEM = {
+		LED_SEQ_STEP(LED_SEQ_LEVEL_ON, 50), LED_SEQ_STEP(LED_SEQ_LEVEL_OFF, 50), LED_SEQ_LOOP
+};
+
+const LED_Step_t LED_Pattern_Heartbeat[] PROGMEM = {
+		LED_SEQ_STEP(LED_SEQ_LEVEL_ON, 10), LED_SEQ_STEP(LED_SEQ_LEVEL_OFF, 15),
+		LED_SEQ_STEP(LED_SEQ_LEVEL_ON, 10), LED_SEQ_STEP(LED_SEQ_LEVEL_OFF, 85), LED_SEQ_LOOP
+};
+
+const LED_Step_t LED_Pattern_Breathe[] PROGMEM = {
+		LED_SEQ_RAMP(LED_SEQ_LEVEL_ON, 100), LED_SEQ_RAMP(LED_SEQ_LEVEL_OFF, 100), LED_SEQ_LOOP
+};
+
+const LED_Step_t LED_Pattern_Error[] PROGMEM = {
+		LED_SEQ_STEP(LED_SEQ_LEVEL_ON, 8), LED_SEQ_STEP(LED_SEQ_LEVEL_OFF, 8),
+		LED_SEQ_STEP(LED_SEQ_LEVEL_ON, 8), LED_SEQ_STEP(LED_SEQ_LEVEL_OFF, 8),
+		LED_SEQ_STEP(LED_SEQ_LEVEL_ON, 8), LED_SEQ_STEP(LED_SEQ_LEVEL_OFF, 8), LED_SEQ_END
+};
+
+/* Moves a slot to the start of step, handles the end markers */
+static void LED_SEQ_Enter_Step(LED_Slot_t *slot, uint8 step){
+	uint8 ticks = pgm_read_byte(&(slot->pattern[step].ticks));
+	if(0 == ticks){
+		if(0 != pgm_read_byte(&(slot->pattern[step].level)))
+			step = 0;
+		else
+			slot->pattern = NULL;
+	}
+	slot->step = step;
+	slot->elapsed = 0;
+	slot->from_level = slot->level;
+}
+
+/* Advances a playing slot by one tick and computes its level, constant work */
+static void LED_SEQ_Advance(LED_Slot_t *slot){
+	uint8 ticks, target;
+	ticks = pgm_read_byte(&(slot->pattern[slot->step].ticks));
+	target = pgm_read_byte(&(slot->pattern[slot->step].level));
+	slot->elapsed++;
+	if(ticks & LED_SEQ_RAMP_FLAG){
+		ticks &= LED_SEQ_TICKS_MASK;
+		slot->level = slot->from_level +
+				(sint16)(((sint16)target - slot->from_level) * slot->elapsed) / ticks;
+	}
+	else
+		slot->level = target;
+	if(slot->elapsed >= ticks)
+		LED_SEQ_Enter_Step(slot, slot->step + 1);
+}
 
 /**=============================================
  * @Fn			- LED_Init
@@ -78,3 +132,266 @@ Std_Returntype LED_Toggle(const LED_t* _LED){
 		ret = GPIO_PIN_Toggle(&(_LED->led_pin));
 	return ret;
 }
+
+/**=============================================
+ * @Fn			- LED_BAM_Init
+ * @brief 		- Initializes the LEDs of a bit angle modulation engine, all off
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- LEDs may be spread over up to LED_BAM_MAX_PORTS ports
+ */
+Std_Returntype LED_BAM_Init(LED_BAM_t *_BAM){
+	Std_Returntype ret = RET_OK;
+	uint8 index, port_index;
+	GPIO_Typedef *GPIOx;
+	if((NULL == _BAM) || (NULL == _BAM->leds) || (0 == _BAM->count) || (LED_BAM_MAX_LEDS < _BAM->count))
+		ret = RET_NOT_OK;
+	else{
+		_BAM->port_count = 0;
+		for(index = 0; (index < _BAM->count) && (RET_OK == ret); index++){
+			GPIOx = _BAM->leds[index].led_pin.GPIOx;
+			for(port_index = 0; (port_index < _BAM->port_count) && (_BAM->port[port_index] != GPIOx); port_index++);
+			if(port_index == _BAM->port_count){
+				if(LED_BAM_MAX_PORTS == port_index)
+					ret = RET_NOT_OK;
+				else{
+					_BAM->port[port_index] = GPIOx;
+					_BAM->port_mask[port_index] = 0;
+					_BAM->port_count++;
+				}
+			}
+			if(RET_OK == ret){
+				_BAM->port_mask[port_index] |= (1U << _BAM->leds[index].led_pin.pin);
+				_BAM->duty[index] = 0;
+				ret |= LED_Init(&(_BAM->leds[index]));
+				ret |= LED_TurnOff(&(_BAM->leds[index]));
+			}
+		}
+		if(RET_OK == ret){
+			_BAM->bit = 0;
+			_BAM->swap_pending = 0;
+			_BAM->active = 1;
+			ret |= LED_BAM_Update(_BAM);
+			/* Show the all off images at once */
+			_BAM->active = 0;
+			_BAM->swap_pending = 0;
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_BAM_Set
+ * @brief 		- Sets the brightness of one LED
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @param [in] 	- index: LED index in the leds array
+ * @param [in] 	- duty: brightness, 0 = off, 255 = on
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Takes effect after LED_BAM_Update
+ */
+Std_Returntype LED_BAM_Set(LED_BAM_t *_BAM, uint8 index, uint8 duty){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _BAM) || (index >= _BAM->count))
+		ret = RET_NOT_OK;
+	else
+		_BAM->duty[index] = duty;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_BAM_Update
+ * @brief 		- Converts the duty values to bit plane port images
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or the previous update is not shown yet (call again later, no value is lost)
+ * Note			- The new images are shown from the start of the next frame, LED_MODE_ActiveLow
+ * 				  is applied here
+ */
+Std_Returntype LED_BAM_Update(LED_BAM_t *_BAM){
+	Std_Returntype ret = RET_OK;
+	uint8 index, port_index, bit, pin_bit, low_mask;
+	uint8 (*plane)[LED_BAM_MAX_PORTS];
+	if((NULL == _BAM) || (_BAM->swap_pending))
+		ret = RET_NOT_OK;
+	else{
+		/* The ISR only reads the active buffer */
+		plane = _BAM->plane[_BAM->active ^ 1];
+		for(port_index = 0; port_index < _BAM->port_count; port_index++){
+			low_mask = 0;
+			for(index = 0; index < _BAM->count; index++){
+				if((_BAM->leds[index].led_pin.GPIOx == _BAM->port[port_index]) &&
+						(LED_MODE_ActiveLow == _BAM->leds[index].led_mode))
+					low_mask |= (1U << _BAM->leds[index].led_pin.pin);
+			}
+			for(bit = 0; bit < LED_BAM_BITS; bit++)
+				plane[bit][port_index] = low_mask;
+		}
+		for(index = 0; index < _BAM->count; index++){
+			for(port_index = 0; _BAM->leds[index].led_pin.GPIOx != _BAM->port[port_index]; port_index++);
+			pin_bit = (1U << _BAM->leds[index].led_pin.pin);
+			/* Active low pins start high in the image, an on bit flips them */
+			for(bit = 0; bit < LED_BAM_BITS; bit++){
+				if((_BAM->duty[index] >> bit) & 0x01)
+					plane[bit][port_index] ^= pin_bit;
+			}
+		}
+		_BAM->swap_pending = 1;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_BAM_Tick
+ * @brief 		- Outputs the next bit plane, one masked write per port
+ * @param [in] 	- _BAM: pointer to the BAM configuration
+ * @param [out] - next_shift: pointer to the variable that will return the weight of the plane just
+ * 				  output, the next interrupt must come after (base period << next_shift)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call from a timer compare ISR and reload the compare period from next_shift.
+ * 				  Frame = 255 base periods, keep it under ~10 ms to avoid flicker
+ */
+Std_Returntype LED_BAM_Tick(LED_BAM_t *_BAM, uint8 *next_shift){
+	Std_Returntype ret = RET_OK;
+	uint8 bit, port_index;
+	GPIO_Typedef *GPIOx;
+	if((NULL == _BAM) || (NULL == next_shift))
+		ret = RET_NOT_OK;
+	else{
+		bit = _BAM->bit;
+		if((0 == bit) && (_BAM->swap_pending)){
+			_BAM->active ^= 1;
+			_BAM->swap_pending = 0;
+		}
+		for(port_index = 0; port_index < _BAM->port_count; port_index++){
+			GPIOx = _BAM->port[port_index];
+			GPIOx->PORT = (GPIOx->PORT & ~(_BAM->port_mask[port_index])) | _BAM->plane[_BAM->active][bit][port_index];
+		}
+		*next_shift = bit;
+		_BAM->bit = (bit + 1) & (LED_BAM_BITS - 1);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_SEQ_Init
+ * @brief 		- Initializes a pattern sequencer with all LEDs off and no pattern
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The LEDs (or the BAM engine) must be initialized first
+ */
+Std_Returntype LED_SEQ_Init(LED_SEQ_t *_SEQ){
+	Std_Returntype ret = RET_OK;
+	uint8 index, priority;
+	if((NULL == _SEQ) || (NULL == _SEQ->leds) || (LED_SEQ_MAX_LEDS < _SEQ->count) ||
+			((NULL != _SEQ->bam) && (_SEQ->count > _SEQ->bam->count)))
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < _SEQ->count; index++){
+			for(priority = 0; priority < LED_SEQ_PRIORITIES; priority++){
+				_SEQ->slot[index][priority].pattern = NULL;
+				_SEQ->slot[index][priority].level = LED_SEQ_LEVEL_OFF;
+			}
+			_SEQ->output[index] = LED_SEQ_LEVEL_OFF;
+		}
+		_SEQ->update_pending = 0;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_SEQ_Play
+ * @brief 		- Starts a pattern on one LED at a priority
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @param [in] 	- index: LED index in the leds array
+ * @param [in] 	- pattern: steps in flash ended by LED_SEQ_LOOP or LED_SEQ_END
+ * @param [in] 	- priority: slot of the pattern @ref LED_SEQ_PRIORITY_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The highest playing priority drives the LED, a lower pattern keeps running
+ * 				  underneath and shows again when the higher one ends
+ */
+Std_Returntype LED_SEQ_Play(LED_SEQ_t *_SEQ, uint8 index, const LED_Step_t *pattern, uint8 priority){
+	Std_Returntype ret = RET_OK;
+	LED_Slot_t *slot;
+	uint8 sreg_state;
+	if((NULL == _SEQ) || (NULL == pattern) || (index >= _SEQ->count) || (LED_SEQ_PRIORITIES <= priority))
+		ret = RET_NOT_OK;
+	else{
+		slot = &(_SEQ->slot[index][priority]);
+		/* LED_SEQ_Tick may run from an ISR */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		slot->pattern = pattern;
+		slot->level = _SEQ->output[index];
+		LED_SEQ_Enter_Step(slot, 0);
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_SEQ_Stop
+ * @brief 		- Stops the pattern of one LED at a priority
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @param [in] 	- index: LED index in the leds array
+ * @param [in] 	- priority: slot of the pattern @ref LED_SEQ_PRIORITY_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype LED_SEQ_Stop(LED_SEQ_t *_SEQ, uint8 index, uint8 priority){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((NULL == _SEQ) || (index >= _SEQ->count) || (LED_SEQ_PRIORITIES <= priority))
+		ret = RET_NOT_OK;
+	else{
+		/* LED_SEQ_Tick may run from an ISR */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		_SEQ->slot[index][priority].pattern = NULL;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- LED_SEQ_Tick
+ * @brief 		- Advances the pattern of every LED by one tick
+ * @param [in] 	- _SEQ: pointer to the sequencer configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call periodically (e.g. every 10 ms), LEDs are written only when their level
+ * 				  changes. With a BAM engine the images are updated at most once per tick
+ */
+Std_Returntype LED_SEQ_Tick(LED_SEQ_t *_SEQ){
+	Std_Returntype ret = RET_OK;
+	LED_Slot_t *slot;
+	uint8 index, priority, level;
+	if(NULL == _SEQ)
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < _SEQ->count; index++){
+			level = LED_SEQ_LEVEL_OFF;
+			/* Every playing slot advances, the highest one is shown */
+			for(priority = 0; priority < LED_SEQ_PRIORITIES; priority++){
+				slot = &(_SEQ->slot[index][priority]);
+				if(NULL != slot->pattern){
+					LED_SEQ_Advance(slot);
+					level = slot->level;
+				}
+			}
+			if(level != _SEQ->output[index]){
+				_SEQ->output[index] = level;
+				if(NULL != _SEQ->bam){
+					ret |= LED_BAM_Set(_SEQ->bam, index, level);
+					_SEQ->update_pending = 1;
+				}
+				else if(level >= 128)
+					ret |= LED_TurnOn(&(_SEQ->leds[index]));
+				else
+					ret |= LED_TurnOff(&(_SEQ->leds[index]));
+			}
+		}
+		/* A busy update (swap pending) is retried on every tick until it is published */
+		if(_SEQ->update_pending && (RET_OK == LED_BAM_Update(_SEQ->bam)))
+			_SEQ->update_pending = 0;
+	}
+	return ret;
+}
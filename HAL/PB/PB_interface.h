@@ -22,6 +22,20 @@ typedef struct{
 	uint8 		mode; // @ref PB_MODE_define
 }PB_t;
 
+typedef struct{
+	/* Configuration, set by the user */
+	GPIO_Typedef	*GPIOx;
+	uint8			mask;			// buttons of the group, one bit per pin
+	uint8			pullup_mask;	// buttons in PB_MODE_PULLUP, the others are PB_MODE_PULLDOWN
+	/* Runtime data, updated by PB_Group_Tick */
+	uint8			xor_mask;		// inverts the pull-up pins so 1 = pressed
+	uint8			cnt0;			// vertical counter, bit 0 of each button
+	uint8			cnt1;			// vertical counter, bit 1 of each button
+	volatile uint8	state;			// debounced state, 1 = pressed
+	volatile uint8	pressed;		// buttons pressed since the last PB_Group_Get_Edges
+	volatile uint8	released;		// buttons released since the last PB_Group_Get_Edges
+}PB_Group_t;
+
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
@@ -59,5 +73,46 @@ Std_Returntype PB_Init(const PB_t* _PB);
  */
 Std_Returntype PB_Read(const PB_t* _PB, uint8 *_state);
 
+/**=============================================
+ * @Fn			- PB_Group_Init
+ * @brief 		- Initializes the pins of a group of buttons on one port
+ * @param [in] 	- group: pointer to the group configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Other pins of the port are not changed
+ */
+Std_Returntype PB_Group_Init(PB_Group_t *group);
+
+/**=============================================
+ * @Fn			- PB_Group_Tick
+ * @brief 		- Samples all buttons of the group with one PIN read and debounces them in parallel
+ * @param [in] 	- group: pointer to the group configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call periodically (e.g. every 5 ms from a timer ISR), a button changes
+ * 				  state after 4 equal samples
+ */
+Std_Returntype PB_Group_Tick(PB_Group_t *group);
+
+/**=============================================
+ * @Fn			- PB_Group_Read
+ * @brief 		- Returns the debounced state of the group
+ * @param [in] 	- group: pointer to the group configuration
+ * @param [out] - state: pointer to the variable that will return the pressed buttons bitmask
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype PB_Group_Read(PB_Group_t *group, uint8 *state);
+
+/**=============================================
+ * @Fn			- PB_Group_Get_Edges
+ * @brief 		- Returns and clears the buttons pressed and released since the previous call
+ * @param [in] 	- group: pointer to the group configuration
+ * @param [out] - pressed: pointer to the variable that will return the pressed bitmask
+ * @param [out] - released: pointer to the variable that will return the released bitmask
+ * @param [out] - changed: pointer to the variable that will return the changed bitmask
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- A button both pressed and released since the previous call is set in both masks
+ */
+Std_Returntype PB_Group_Get_Edges(PB_Group_t *group, uint8 *pressed, uint8 *released, uint8 *changed);
+
 
 #endif /* HAL_PB_PB_INTERFACE_H_ */
@@ -42,10 +42,112 @@ Std_Returntype PB_Read(const PB_t* _PB, uint8 *_state){
 		ret = RET_NOT_OK;
 	else{
 		ret |= GPIO_PIN_Read(&(_PB->pin), _state);
-		if(PB_MODE_PULLUP == _PB->mode){
-			*_state = (*_state == PB_PRESSED) ? PB_RELEASED : PB_PRESSED;
-		}
-		else{ /* Do Nothing */ }
+		/* A pulled-up button reads low when pressed */
+		*_state ^= (PB_MODE_PULLUP == _PB->mode);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- PB_Group_Init
+ * @brief 		- Initializes the pins of a group of buttons on one port
+ * @param [in] 	- group: pointer to the group configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Other pins of the port are not changed
+ */
+Std_Returntype PB_Group_Init(PB_Group_t *group){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((NULL == group) || (NULL == group->GPIOx) || (0 == group->mask))
+		ret = RET_NOT_OK;
+	else{
+		group->pullup_mask &= group->mask;
+		group->xor_mask = group->pullup_mask;
+		group->cnt0 = 0;
+		group->cnt1 = 0;
+		group->state = 0;
+		group->pressed = 0;
+		group->released = 0;
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		group->GPIOx->DDR &= ~(group->mask);
+		group->GPIOx->PORT = (group->GPIOx->PORT & ~(group->mask)) | group->pullup_mask;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- PB_Group_Tick
+ * @brief 		- Samples all buttons of the group with one PIN read and debounces them in parallel
+ * @param [in] 	- group: pointer to the group configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call periodically (e.g. every 5 ms from a timer ISR), a button changes
+ * 				  state after 4 equal samples
+ */
+Std_Returntype PB_Group_Tick(PB_Group_t *group){
+	Std_Returntype ret = RET_OK;
+	uint8 sample, delta, toggle, state;
+	if(NULL == group)
+		ret = RET_NOT_OK;
+	else{
+		state = group->state;
+		sample = (group->GPIOx->PIN ^ group->xor_mask) & group->mask;
+		/* 2 bit counter per button, counting samples that differ from the state.
+		 * Equal samples reset it, the state toggles when it wraps after 4 */
+		delta = sample ^ state;
+		group->cnt1 = (group->cnt1 ^ group->cnt0) & delta;
+		group->cnt0 = ~(group->cnt0) & delta;
+		toggle = delta & ~(group->cnt0 | group->cnt1);
+		state ^= toggle;
+		group->state = state;
+		group->pressed |= toggle & state;
+		group->released |= toggle & ~state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- PB_Group_Read
+ * @brief 		- Returns the debounced state of the group
+ * @param [in] 	- group: pointer to the group configuration
+ * @param [out] - state: pointer to the variable that will return the pressed buttons bitmask
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype PB_Group_Read(PB_Group_t *group, uint8 *state){
+	Std_Returntype ret = RET_OK;
+	if((NULL == group) || (NULL == state))
+		ret = RET_NOT_OK;
+	else
+		*state = group->state;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- PB_Group_Get_Edges
+ * @brief 		- Returns and clears the buttons pressed and released since the previous call
+ * @param [in] 	- group: pointer to the group configuration
+ * @param [out] - pressed: pointer to the variable that will return the pressed bitmask
+ * @param [out] - released: pointer to the variable that will return the released bitmask
+ * @param [out] - changed: pointer to the variable that will return the changed bitmask
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- A button both pressed and released since the previous call is set in both masks
+ */
+Std_Returntype PB_Group_Get_Edges(PB_Group_t *group, uint8 *pressed, uint8 *released, uint8 *changed){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((NULL == group) || (NULL == pressed) || (NULL == released) || (NULL == changed))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		*pressed = group->pressed;
+		*released = group->released;
+		group->pressed = 0;
+		group->released = 0;
+		SREG = sreg_state;
+		*changed = *pressed | *released;
 	}
 	return ret;
 }
@@ -14,6 +14,19 @@
 //----------------------------------------------
 #include "../../MCAL/GPIO/GPIO_interface.h"
 
+//----------------------------------------------
+// Section: Macros Configuration
+//----------------------------------------------
+
+/* Capacity of SS_Mux_t */
+#define SS_MUX_MAX_DIGITS		4
+
+/* Symbols of the numbers table (0 -> F) */
+#define SS_SYMBOLS				16
+
+/* Segment pattern bits, bit 0 = a ... bit 6 = g */
+#define SS_SEGMENT_DP			0x80
+
 //----------------------------------------------
 // Section: User type definitions
 //----------------------------------------------
@@ -21,9 +34,37 @@ typedef struct{
 	uint8 		mode;		// @ref SS_MODE_define
 	uint8		ON_State;	// @ref GPIO_STATE_define
 	uint8		OFF_State;	// @ref GPIO_STATE_define
-	pinCfg_t 	PIN[7];
+	pinCfg_t 	PIN[8];		// a -> g then DP, PIN[7].GPIOx = NULL if the DP is not wired
+	/* Port images of 0 -> F, computed by SS_Init when all segments share a port */
+	uint8		fast;
+	uint8		mask;
+	uint8		image[SS_SYMBOLS];
 }SS_t;
 
+typedef struct{
+	/* Configuration, set by the user */
+	uint8 		mode;						// segments polarity @ref SS_MODE_define
+	uint8		DIGIT_ON_State;				// level that enables a digit common @ref GPIO_STATE_define
+	uint8		digits;						// digits in use, at most SS_MUX_MAX_DIGITS
+	uint8		ticks_per_digit;			// SS_Mux_Refresh calls per digit (scan rate divider)
+	pinCfg_t 	SEG_PIN[8];					// a -> g then DP (GPIOx = NULL if not wired), all on one port
+	pinCfg_t	DIGIT_PIN[SS_MUX_MAX_DIGITS];	// leftmost first, all on one port
+	/* Port images, computed by SS_Mux_Init */
+	GPIO_Typedef	*seg_port;
+	GPIO_Typedef	*digit_port;
+	uint8		seg_mask;
+	uint8		seg_bit[8];
+	uint8		seg_off_image;
+	uint8		digit_mask;
+	uint8		digit_off_image;
+	uint8		digit_on_image[SS_MUX_MAX_DIGITS];
+	/* Frame buffer, segment port image of each digit */
+	volatile uint8	frame[SS_MUX_MAX_DIGITS];
+	/* Runtime data, updated by SS_Mux_Refresh */
+	uint8		current;
+	uint8		tick;
+}SS_Mux_t;
+
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
@@ -51,11 +92,111 @@ Std_Returntype SS_Init(SS_t *_SS);
  * @Fn			- SS_Display
  * @brief 		- Displays a number on the seven segments
  * @param [in] 	- _SS: Pointer to the seven segment configuration
- * @param [in] 	- _number: Number to be displayed (0 -> 9)
+ * @param [in] 	- _number: Number to be displayed (0 -> F)
  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
- * Note			- SS_Init MUST be called first
+ * Note			- SS_Init MUST be called first. With all segments on one port it is a single
+ * 				  masked write, other pins of that port must not be written from an ISR meanwhile
  */
 Std_Returntype SS_Display(const SS_t* _SS, uint8 _number);
 
+/**=============================================
+ * @Fn			- SS_Set_DP
+ * @brief 		- Turns the decimal point on or off
+ * @param [in] 	- _SS: Pointer to the seven segment configuration
+ * @param [in] 	- _state: 1 to turn the decimal point on, 0 to turn it off
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- SS_Display does not change the decimal point
+ */
+Std_Returntype SS_Set_DP(const SS_t* _SS, uint8 _state);
+
+/**=============================================
+ * @Fn			- SS_Get_Glyph
+ * @brief 		- Returns the segment pattern of a character
+ * @param [in] 	- character: digit, letter or symbol (' ', '-', '_', '=', '"', '\'', '(', ')', '/', '?', '*' for degree)
+ * @param [out] - pattern: pointer to the variable that will return the pattern (bit 0 = a ... bit 6 = g)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the character
+ * 				  cannot be shown (pattern is blank then)
+ * Note			- The glyph table is stored in flash
+ */
+Std_Returntype SS_Get_Glyph(uint8 character, uint8 *pattern);
+
+/**=============================================
+ * @Fn			- SS_Mux_Init
+ * @brief 		- Initializes a multiplexed display and computes its port images
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Segment pins must share one port and digit pins must share one port.
+ * 				  All digits start blank
+ */
+Std_Returntype SS_Mux_Init(SS_Mux_t *_MUX);
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Digit
+ * @brief 		- Writes a number to one digit of the frame buffer
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- position: digit index, 0 is the leftmost
+ * @param [in] 	- _number: Number to be displayed (0 -> F)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM buffer is written, SS_Mux_Refresh shows it
+ */
+Std_Returntype SS_Mux_Write_Digit(SS_Mux_t *_MUX, uint8 position, uint8 _number);
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Segments
+ * @brief 		- Writes a raw segment pattern to one digit of the frame buffer
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- position: digit index, 0 is the leftmost
+ * @param [in] 	- pattern: bit 0 = segment a ... bit 6 = segment g, SS_SEGMENT_DP, 0 blanks the digit
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM buffer is written, SS_Mux_Refresh shows it
+ */
+Std_Returntype SS_Mux_Write_Segments(SS_Mux_t *_MUX, uint8 position, uint8 pattern);
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Number
+ * @brief 		- Writes a decimal number right aligned, leading zeros blank
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- value: number to be displayed
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the number
+ * 				  does not fit in the digits
+ * Note			- Only the RAM buffer is written, SS_Mux_Refresh shows it
+ */
+Std_Returntype SS_Mux_Write_Number(SS_Mux_t *_MUX, uint32 value);
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Fixed
+ * @brief 		- Writes a signed fixed point number right aligned with the decimal point
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- value: number scaled by 10^decimals (e.g. 1234 with 2 decimals shows 12.34)
+ * @param [in] 	- decimals: digits after the decimal point
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the number
+ * 				  does not fit in the digits
+ * Note			- Leading zeros before the units digit are blank, a '-' precedes negative numbers.
+ * 				  Needs the DP pin when decimals is not 0
+ */
+Std_Returntype SS_Mux_Write_Fixed(SS_Mux_t *_MUX, sint32 value, uint8 decimals);
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_String
+ * @brief 		- Writes a string left aligned, a '.' lights the DP of the previous character
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- str: null terminated string, unused digits are blank
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the string is
+ * 				  too long or has characters without a glyph (shown blank)
+ * Note			- See SS_Get_Glyph for the characters
+ */
+Std_Returntype SS_Mux_Write_String(SS_Mux_t *_MUX, const char *str);
+
+/**=============================================
+ * @Fn			- SS_Mux_Refresh
+ * @brief 		- Moves the display to the next digit every ticks_per_digit calls
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call from a timer ISR. Refresh rate = tick rate / (ticks_per_digit * digits),
+ * 				  keep it above ~60 Hz to avoid flicker. Each step blanks the digits, writes the
+ * 				  segments and enables the next digit, three masked port writes
+ */
+Std_Returntype SS_Mux_Refresh(SS_Mux_t *_MUX);
+
 
 #endif /* HAL_SEVEN_SEGMENT_SS_INTERFACE_H_ */
@@ -8,10 +8,42 @@
 /*************************************************************************/
 
 #include "SS_interface.h"
+#include <avr/pgmspace.h>
 
-#define SS_PINS		7
-uint8 SS_numbers_hexa[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66,
-								0x6D, 0x7D, 0x07, 0x7F, 0x6f};
+#define SS_SEGMENTS		7
+#define SS_DP_INDEX		7
+#define SS_PINS			8
+
+/* Glyphs of ASCII 0x20 -> 0x7F, bit 0 = a ... bit 6 = g, 0 = no glyph */
+#define SS_GLYPH_FIRST	0x20
+#define SS_GLYPH_COUNT	96
+static const uint8 SS_Glyphs[SS_GLYPH_COUNT] PROGMEM = {
+		/* space ! " # $ % & ' */	0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02,
+		/* ( ) * + , - . / */		0x39, 0x0F, 0x63, 0x00, 0x00, 0x40, 0x00, 0x52,
+		/* 0 -> 7 */				0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+		/* 8 9 : ; < = > ? */		0x7F, 0x6F, 0x00, 0x00, 0x00, 0x48, 0x00, 0x53,
+		/* @ A -> G */				0x00, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71, 0x3D,
+		/* H -> O */				0x76, 0x30, 0x1E, 0x75, 0x38, 0x37, 0x54, 0x3F,
+		/* P -> W */				0x73, 0x67, 0x50, 0x6D, 0x78, 0x3E, 0x1C, 0x2A,
+		/* X Y Z [ backslash ] ^ _ */	0x76, 0x6E, 0x5B, 0x39, 0x64, 0x0F, 0x23, 0x08,
+		/* ` a -> g */				0x20, 0x5F, 0x7C, 0x58, 0x5E, 0x7B, 0x71, 0x6F,
+		/* h -> o */				0x74, 0x10, 0x0E, 0x75, 0x30, 0x37, 0x54, 0x5C,
+		/* p -> w */				0x73, 0x67, 0x50, 0x6D, 0x78, 0x1C, 0x1C, 0x2A,
+		/* x y z { | } ~ DEL */		0x76, 0x6E, 0x5B, 0x39, 0x30, 0x0F, 0x01, 0x00
+};
+
+/* Out of range characters are blank, no indexing outside the table */
+static uint8 SS_Glyph(uint8 character){
+	uint8 pattern = 0;
+	if((character >= SS_GLYPH_FIRST) && (character < (SS_GLYPH_FIRST + SS_GLYPH_COUNT)))
+		pattern = pgm_read_byte(&SS_Glyphs[character - SS_GLYPH_FIRST]);
+	return pattern;
+}
+
+/* Pattern of 0 -> F */
+static uint8 SS_Hex_Glyph(uint8 number){
+	return SS_Glyph((number < 10) ? ('0' + number) : ('A' + number - 10));
+}
 
 
 /**=============================================
@@ -23,7 +55,7 @@ uint8 SS_numbers_hexa[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66,
  */
 Std_Returntype SS_Init(SS_t *_SS){
 	Std_Returntype ret = RET_OK;
-	uint8 index;
+	uint8 index, number, on_bits;
 	if(NULL == _SS)
 		ret = RET_NOT_OK;
 	else{
@@ -36,10 +68,29 @@ Std_Returntype SS_Init(SS_t *_SS){
 			_SS->OFF_State = GPIO_STATE_LOW;
 		}
 
+		_SS->fast = 1;
+		_SS->mask = 0;
 		for(index = 0; index < SS_PINS; index++){
 			/* Set initial state OFF for all segments */
 			_SS->PIN[index].default_state = _SS->OFF_State;
-			ret |= GPIO_PIN_Init(&(_SS->PIN[index]));
+			if((SS_DP_INDEX != index) || (NULL != _SS->PIN[SS_DP_INDEX].GPIOx))
+				ret |= GPIO_PIN_Init(&(_SS->PIN[index]));
+		}
+		/* The DP is left out of the mask so SS_Display keeps it */
+		for(index = 0; index < SS_SEGMENTS; index++){
+			if(_SS->PIN[index].GPIOx != _SS->PIN[0].GPIOx)
+				_SS->fast = 0;
+			_SS->mask |= (1U << _SS->PIN[index].pin);
+		}
+
+		/* Port image of every symbol for this pin mapping and polarity */
+		for(number = 0; number < SS_SYMBOLS; number++){
+			on_bits = 0;
+			for(index = 0; index < SS_SEGMENTS; index++){
+				if((SS_Hex_Glyph(number) >> index) & 0x01)
+					on_bits |= (1U << _SS->PIN[index].pin);
+			}
+			_SS->image[number] = (GPIO_STATE_HIGH == _SS->ON_State) ? on_bits : (_SS->mask & ~on_bits);
 		}
 	}
 	return ret;
@@ -49,18 +100,24 @@ Std_Returntype SS_Init(SS_t *_SS){
  * @Fn			- SS_Display
  * @brief 		- Displays a number on the seven segments
  * @param [in] 	- _SS: Pointer to the seven segment configuration
- * @param [in] 	- _number: Number to be displayed on the seven segment @ref SS_NUMBERS_define
+ * @param [in] 	- _number: Number to be displayed (0 -> F)
  * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
- * Note			- SS_Init MUST be called first
+ * Note			- SS_Init MUST be called first. With all segments on one port it is a single
+ * 				  masked write, other pins of that port must not be written from an ISR meanwhile
  */
 Std_Returntype SS_Display(const SS_t* _SS, uint8 _number){
 	Std_Returntype ret = RET_OK;
 	uint8 index;
-	if(NULL == _SS)
+	GPIO_Typedef *port;
+	if((NULL == _SS) || (_number >= SS_SYMBOLS))
 		ret = RET_NOT_OK;
+	else if(_SS->fast){
+		port = _SS->PIN[0].GPIOx;
+		port->PORT = (port->PORT & ~(_SS->mask)) | _SS->image[_number];
+	}
 	else{
-		for(index = 0; index < SS_PINS; index++){
-			if((SS_numbers_hexa[_number]>>index) & 0x01)
+		for(index = 0; index < SS_SEGMENTS; index++){
+			if((SS_Hex_Glyph(_number)>>index) & 0x01)
 				ret |= GPIO_PIN_Write(&(_SS->PIN[index]), _SS->ON_State);
 			else
 				ret |= GPIO_PIN_Write(&(_SS->PIN[index]), _SS->OFF_State);
@@ -68,3 +125,286 @@ Std_Returntype SS_Display(const SS_t* _SS, uint8 _number){
 	}
 	return ret;
 }
+
+/**=============================================
+ * @Fn			- SS_Set_DP
+ * @brief 		- Turns the decimal point on or off
+ * @param [in] 	- _SS: Pointer to the seven segment configuration
+ * @param [in] 	- _state: 1 to turn the decimal point on, 0 to turn it off
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- SS_Display does not change the decimal point
+ */
+Std_Returntype SS_Set_DP(const SS_t* _SS, uint8 _state){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _SS) || (NULL == _SS->PIN[SS_DP_INDEX].GPIOx))
+		ret = RET_NOT_OK;
+	else
+		ret |= GPIO_PIN_Write(&(_SS->PIN[SS_DP_INDEX]), (_state) ? _SS->ON_State : _SS->OFF_State);
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Get_Glyph
+ * @brief 		- Returns the segment pattern of a character
+ * @param [in] 	- character: digit, letter or symbol (' ', '-', '_', '=', '"', '\'', '(', ')', '/', '?', '*' for degree)
+ * @param [out] - pattern: pointer to the variable that will return the pattern (bit 0 = a ... bit 6 = g)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the character
+ * 				  cannot be shown (pattern is blank then)
+ * Note			- The glyph table is stored in flash
+ */
+Std_Returntype SS_Get_Glyph(uint8 character, uint8 *pattern){
+	Std_Returntype ret = RET_OK;
+	if(NULL == pattern)
+		ret = RET_NOT_OK;
+	else{
+		*pattern = SS_Glyph(character);
+		if((0 == *pattern) && (' ' != character))
+			ret = RET_NOT_OK;
+	}
+	return ret;
+}
+
+/* Port image of a segment pattern, bit n of pattern drives seg_bit[n] */
+static uint8 SS_Mux_Image(const SS_Mux_t *_MUX, uint8 pattern){
+	uint8 index;
+	uint8 on_bits = 0;
+	for(index = 0; index < SS_PINS; index++){
+		if((pattern >> index) & 0x01)
+			on_bits |= _MUX->seg_bit[index];
+	}
+	/* Common anode segments are on when low */
+	return (SS_MODE_CommonAnode == _MUX->mode) ? (_MUX->seg_mask & ~on_bits) : on_bits;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Init
+ * @brief 		- Initializes a multiplexed display and computes its port images
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Segment pins must share one port and digit pins must share one port.
+ * 				  All digits start blank
+ */
+Std_Returntype SS_Mux_Init(SS_Mux_t *_MUX){
+	Std_Returntype ret = RET_OK;
+	uint8 index, digit_bit;
+	if((NULL == _MUX) || (0 == _MUX->digits) || (SS_MUX_MAX_DIGITS < _MUX->digits))
+		ret = RET_NOT_OK;
+	else{
+		_MUX->seg_port = _MUX->SEG_PIN[0].GPIOx;
+		_MUX->digit_port = _MUX->DIGIT_PIN[0].GPIOx;
+		_MUX->seg_mask = 0;
+		_MUX->digit_mask = 0;
+		for(index = 0; index < SS_PINS; index++){
+			if((SS_DP_INDEX == index) && (NULL == _MUX->SEG_PIN[index].GPIOx))
+				_MUX->seg_bit[index] = 0;
+			else{
+				if(_MUX->SEG_PIN[index].GPIOx != _MUX->seg_port)
+					ret = RET_NOT_OK;
+				_MUX->seg_bit[index] = (1U << _MUX->SEG_PIN[index].pin);
+			}
+			_MUX->seg_mask |= _MUX->seg_bit[index];
+		}
+		for(index = 0; index < _MUX->digits; index++){
+			if(_MUX->DIGIT_PIN[index].GPIOx != _MUX->digit_port)
+				ret = RET_NOT_OK;
+			_MUX->digit_mask |= (1U << _MUX->DIGIT_PIN[index].pin);
+		}
+		if(RET_OK == ret){
+			_MUX->seg_off_image = SS_Mux_Image(_MUX, 0);
+			_MUX->digit_off_image = (GPIO_STATE_HIGH == _MUX->DIGIT_ON_State) ? 0 : _MUX->digit_mask;
+			for(index = 0; index < _MUX->digits; index++){
+				digit_bit = (1U << _MUX->DIGIT_PIN[index].pin);
+				_MUX->digit_on_image[index] = _MUX->digit_off_image ^ digit_bit;
+				_MUX->frame[index] = _MUX->seg_off_image;
+			}
+			_MUX->current = 0;
+			_MUX->tick = 0;
+
+			/* All digits off first, then the segments */
+			for(index = 0; index < _MUX->digits; index++){
+				_MUX->DIGIT_PIN[index].default_state = !(_MUX->DIGIT_ON_State);
+				ret |= GPIO_PIN_Init(&(_MUX->DIGIT_PIN[index]));
+			}
+			for(index = 0; index < SS_PINS; index++){
+				_MUX->SEG_PIN[index].default_state = (SS_MODE_CommonAnode == _MUX->mode) ? GPIO_STATE_HIGH : GPIO_STATE_LOW;
+				if(0 != _MUX->seg_bit[index])
+					ret |= GPIO_PIN_Init(&(_MUX->SEG_PIN[index]));
+			}
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Digit
+ * @brief 		- Writes a number to one digit of the frame buffer
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- position: digit index, 0 is the leftmost
+ * @param [in] 	- _number: Number to be displayed (0 -> F)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM buffer is written, SS_Mux_Refresh shows it
+ */
+Std_Returntype SS_Mux_Write_Digit(SS_Mux_t *_MUX, uint8 position, uint8 _number){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _MUX) || (position >= _MUX->digits) || (_number >= SS_SYMBOLS))
+		ret = RET_NOT_OK;
+	else
+		_MUX->frame[position] = SS_Mux_Image(_MUX, SS_Hex_Glyph(_number));
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Segments
+ * @brief 		- Writes a raw segment pattern to one digit of the frame buffer
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- position: digit index, 0 is the leftmost
+ * @param [in] 	- pattern: bit 0 = segment a ... bit 6 = segment g, 0 blanks the digit
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Only the RAM buffer is written, SS_Mux_Refresh shows it
+ */
+Std_Returntype SS_Mux_Write_Segments(SS_Mux_t *_MUX, uint8 position, uint8 pattern){
+	Std_Returntype ret = RET_OK;
+	if((NULL == _MUX) || (position >= _MUX->digits))
+		ret = RET_NOT_OK;
+	else
+		_MUX->frame[position] = SS_Mux_Image(_MUX, pattern);
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Number
+ * @brief 		- Writes a decimal number right aligned, leading zeros blank
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- value: number to be displayed
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the number
+ * 				  does not fit in the digits
+ * Note			- Only the RAM buffer is written, SS_Mux_Refresh shows it
+ */
+Std_Returntype SS_Mux_Write_Number(SS_Mux_t *_MUX, uint32 value){
+	Std_Returntype ret = RET_OK;
+	if(value > 0x7FFFFFFFUL)
+		ret = RET_NOT_OK;
+	else
+		ret = SS_Mux_Write_Fixed(_MUX, (sint32)value, 0);
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_Fixed
+ * @brief 		- Writes a signed fixed point number right aligned with the decimal point
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- value: number scaled by 10^decimals (e.g. 1234 with 2 decimals shows 12.34)
+ * @param [in] 	- decimals: digits after the decimal point
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the number
+ * 				  does not fit in the digits
+ * Note			- Leading zeros before the units digit are blank, a '-' precedes negative numbers.
+ * 				  Needs the DP pin when decimals is not 0
+ */
+Std_Returntype SS_Mux_Write_Fixed(SS_Mux_t *_MUX, sint32 value, uint8 decimals){
+	Std_Returntype ret = RET_OK;
+	uint8 patterns[SS_MUX_MAX_DIGITS];
+	uint8 position, used, pattern;
+	uint32 magnitude;
+	if((NULL == _MUX) || (0 == _MUX->digits) || (decimals >= _MUX->digits))
+		ret = RET_NOT_OK;
+	else{
+		magnitude = (value < 0) ? (0UL - (uint32)value) : (uint32)value;
+		/* Digits from the right, at least the units digit and the decimals */
+		used = 0;
+		do{
+			pattern = SS_Glyph('0' + (magnitude % 10));
+			if((0 != decimals) && (used == decimals))
+				pattern |= SS_SEGMENT_DP;
+			patterns[_MUX->digits - 1 - used] = pattern;
+			magnitude /= 10;
+			used++;
+		}while(((0 != magnitude) || (used <= decimals)) && (used < _MUX->digits));
+		if(value < 0){
+			if(used < _MUX->digits){
+				patterns[_MUX->digits - 1 - used] = SS_Glyph('-');
+				used++;
+			}
+			else
+				ret = RET_NOT_OK;
+		}
+		if(0 != magnitude)
+			ret = RET_NOT_OK;
+
+		/* Only a number that fits is shown */
+		if(RET_OK == ret){
+			for(position = 0; position < _MUX->digits; position++){
+				pattern = (position < (_MUX->digits - used)) ? 0 : patterns[position];
+				_MUX->frame[position] = SS_Mux_Image(_MUX, pattern);
+			}
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Write_String
+ * @brief 		- Writes a string left aligned, a '.' lights the DP of the previous character
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @param [in] 	- str: null terminated string, unused digits are blank
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if the string is
+ * 				  too long or has characters without a glyph (shown blank)
+ * Note			- See SS_Get_Glyph for the characters
+ */
+Std_Returntype SS_Mux_Write_String(SS_Mux_t *_MUX, const char *str){
+	Std_Returntype ret = RET_OK;
+	uint8 patterns[SS_MUX_MAX_DIGITS];
+	uint8 position = 0;
+	uint8 pattern;
+	if((NULL == _MUX) || (NULL == str))
+		ret = RET_NOT_OK;
+	else{
+		for(; '\0' != *str; str++){
+			if(('.' == *str) && (0 != position) && (0 == (patterns[position - 1] & SS_SEGMENT_DP)))
+				patterns[position - 1] |= SS_SEGMENT_DP;
+			else if(position < _MUX->digits){
+				if('.' == *str)
+					pattern = SS_SEGMENT_DP;
+				else
+					ret |= SS_Get_Glyph((uint8)*str, &pattern);
+				patterns[position] = pattern;
+				position++;
+			}
+			else
+				ret = RET_NOT_OK;
+		}
+		for(; position < _MUX->digits; position++)
+			patterns[position] = 0;
+		for(position = 0; position < _MUX->digits; position++)
+			_MUX->frame[position] = SS_Mux_Image(_MUX, patterns[position]);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- SS_Mux_Refresh
+ * @brief 		- Moves the display to the next digit every ticks_per_digit calls
+ * @param [in] 	- _MUX: Pointer to the multiplexed display configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Call from a timer ISR. Refresh rate = tick rate / (ticks_per_digit * digits),
+ * 				  keep it above ~60 Hz to avoid flicker. Each step blanks the digits, writes the
+ * 				  segments and enables the next digit, three masked port writes
+ */
+Std_Returntype SS_Mux_Refresh(SS_Mux_t *_MUX){
+	Std_Returntype ret = RET_OK;
+	uint8 current;
+	if(NULL == _MUX)
+		ret = RET_NOT_OK;
+	else if(++(_MUX->tick) >= _MUX->ticks_per_digit){
+		_MUX->tick = 0;
+		current = _MUX->current + 1;
+		if(current >= _MUX->digits)
+			current = 0;
+		_MUX->current = current;
+		/* Blank before changing the segments, otherwise the old digit shows the new pattern briefly */
+		_MUX->digit_port->PORT = (_MUX->digit_port->PORT & ~(_MUX->digit_mask)) | _MUX->digit_off_image;
+		_MUX->seg_port->PORT = (_MUX->seg_port->PORT & ~(_MUX->seg_mask)) | _MUX->frame[current];
+		_MUX->digit_port->PORT = (_MUX->digit_port->PORT & ~(_MUX->digit_mask)) | _MUX->digit_on_image[current];
+	}
+	else{ /* Do Nothing */ }
+	return ret;
+}
@@ -0,0 +1,112 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : AC_interface.h                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef MCAL_AC_AC_INTERFACE_H_
+#define MCAL_AC_AC_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../ATMEGA32.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint8 positive_input;	// @ref AC_POSITIVE_define
+	uint8 negative_input;	// @ref AC_NEGATIVE_define
+	uint8 interrupt_mode;	// @ref AC_INTERRUPT_define
+	uint8 input_capture;	// @ref AC_INPUT_CAPTURE_define
+	void (*pf_callback)(void);
+}AC_cfg;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref AC_POSITIVE_define
+#define AC_POSITIVE_AIN0			0
+#define AC_POSITIVE_BANDGAP			1
+
+// @ref AC_NEGATIVE_define
+/* ADC0..ADC7 go through the ADC multiplexer, which is borrowed from the ADC driver */
+#define AC_NEGATIVE_ADC0			0
+#define AC_NEGATIVE_ADC1			1
+#define AC_NEGATIVE_ADC2			2
+#define AC_NEGATIVE_ADC3			3
+#define AC_NEGATIVE_ADC4			4
+#define AC_NEGATIVE_ADC5			5
+#define AC_NEGATIVE_ADC6			6
+#define AC_NEGATIVE_ADC7			7
+#define AC_NEGATIVE_AIN1			8
+
+// @ref AC_INTERRUPT_define
+#define AC_INTERRUPT_TOGGLE			0
+#define AC_INTERRUPT_FALLING_EDGE	2
+#define AC_INTERRUPT_RISING_EDGE	3
+#define AC_INTERRUPT_DISABLE		0xFF
+
+// @ref AC_INPUT_CAPTURE_define
+#define AC_INPUT_CAPTURE_DISABLE	0
+#define AC_INPUT_CAPTURE_ENABLE		1
+
+// @ref AC_OUTPUT_define
+#define AC_OUTPUT_LOW				0	/* positive input below negative input */
+#define AC_OUTPUT_HIGH				1	/* positive input above negative input */
+
+/*
+ * =============================================
+ * APIs Supported by "Analog Comparator"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- AC_Init
+ * @brief 		- Configures and enables the analog comparator
+ * @param [in] 	- cfg: pointer to the analog comparator configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Selecting an ADC pin as negative input fails while the ADC is busy, and disables the ADC
+ */
+Std_Returntype AC_Init(const AC_cfg *cfg);
+
+/**=============================================
+ * @Fn			- AC_DeInit
+ * @brief 		- Disables the analog comparator and gives the ADC multiplexer back
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype AC_DeInit(void);
+
+/**=============================================
+ * @Fn			- AC_Select_Negative_Input
+ * @brief 		- Changes the negative input of the comparator
+ * @param [in] 	- input: new negative input @ref AC_NEGATIVE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The comparator interrupt is masked during the switch to avoid false triggers
+ */
+Std_Returntype AC_Select_Negative_Input(uint8 input);
+
+/**=============================================
+ * @Fn			- AC_Read_Output
+ * @brief 		- Returns the current comparator output
+ * @param [out] - state: pointer to the variable that will return the output @ref AC_OUTPUT_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype AC_Read_Output(uint8 *state);
+
+/**=============================================
+ * @Fn			- AC_SetCallBack
+ * @brief 		- Sets the callback function of the comparator interrupt
+ * @param [in] 	- pf_callback: pointer to the function to be set as callback
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype AC_SetCallBack(void (*pf_callback)(void));
+
+#endif /* MCAL_AC_AC_INTERFACE_H_ */
@@ -0,0 +1,152 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : AC_program.c                           				 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "AC_interface.h"
+#include "../ADC/ADC_interface.h"
+
+static void (*AC_Callback)(void);
+
+static uint8 AC_Interrupt_Mode = AC_INTERRUPT_DISABLE;
+
+/* Routes the negative input, ADC pins borrow the ADC multiplexer */
+static Std_Returntype AC_Route_Negative_Input(uint8 input){
+	Std_Returntype ret = RET_OK;
+	if(AC_NEGATIVE_AIN1 == input){
+		if(AC->SFIOR.ACME){
+			AC->SFIOR.ACME = 0;
+			ret |= ADC_Mux_Unlock();
+		}
+	}
+	else if(AC_NEGATIVE_ADC7 >= input){
+		/* Already borrowed: just move the multiplexer */
+		if(AC->SFIOR.ACME)
+			ADC->ADMUX.MUX = input;
+		else{
+			ret |= ADC_Mux_Lock(input);
+			if(RET_OK == ret)
+				AC->SFIOR.ACME = 1;
+		}
+	}
+	else
+		ret = RET_NOT_OK;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- AC_Init
+ * @brief 		- Configures and enables the analog comparator
+ * @param [in] 	- cfg: pointer to the analog comparator configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Selecting an ADC pin as negative input fails while the ADC is busy, and disables the ADC
+ */
+Std_Returntype AC_Init(const AC_cfg *cfg){
+	Std_Returntype ret = RET_OK;
+	uint8 interrupt_enable;
+	if((NULL == cfg) || (AC_POSITIVE_BANDGAP < cfg->positive_input) ||
+			((AC_INTERRUPT_TOGGLE != cfg->interrupt_mode) && (AC_INTERRUPT_FALLING_EDGE != cfg->interrupt_mode) &&
+			(AC_INTERRUPT_RISING_EDGE != cfg->interrupt_mode) && (AC_INTERRUPT_DISABLE != cfg->interrupt_mode)))
+		ret = RET_NOT_OK;
+	else{
+		/* The interrupt is masked while the input moves, the rest of ACSR waits for the routing */
+		interrupt_enable = AC->ACSR.ACIE;
+		AC->ACSR.ACIE = 0;
+		ret |= AC_Route_Negative_Input(cfg->negative_input);
+
+		if(RET_OK != ret)
+			AC->ACSR.ACIE = interrupt_enable;
+		else{
+			/* Power the comparator on */
+			AC->ACSR.ACD = 0;
+			AC->ACSR.ACBG = cfg->positive_input;
+			AC->ACSR.ACIC = (AC_INPUT_CAPTURE_ENABLE == cfg->input_capture);
+			AC_Interrupt_Mode = cfg->interrupt_mode;
+			if(AC_INTERRUPT_DISABLE != cfg->interrupt_mode){
+				AC_Callback = cfg->pf_callback;
+				AC->ACSR.ACIS = cfg->interrupt_mode;
+				AC->ACSR.ACI = 1; // Clear flag raised by the configuration change
+				AC->ACSR.ACIE = 1;
+				GLOBAL_INTERRUPT_ENABLE();
+			}
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- AC_DeInit
+ * @brief 		- Disables the analog comparator and gives the ADC multiplexer back
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype AC_DeInit(void){
+	Std_Returntype ret = RET_OK;
+	AC->ACSR.ACIE = 0;
+	AC->ACSR.ACIC = 0;
+	ret |= AC_Route_Negative_Input(AC_NEGATIVE_AIN1);
+	AC->ACSR.ACD = 1;
+	AC_Interrupt_Mode = AC_INTERRUPT_DISABLE;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- AC_Select_Negative_Input
+ * @brief 		- Changes the negative input of the comparator
+ * @param [in] 	- input: new negative input @ref AC_NEGATIVE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The comparator interrupt is masked during the switch to avoid false triggers
+ */
+Std_Returntype AC_Select_Negative_Input(uint8 input){
+	Std_Returntype ret = RET_OK;
+	AC->ACSR.ACIE = 0;
+	ret |= AC_Route_Negative_Input(input);
+	if(AC_INTERRUPT_DISABLE != AC_Interrupt_Mode){
+		AC->ACSR.ACI = 1; // Clear flag raised by the input switch
+		AC->ACSR.ACIE = 1;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- AC_Read_Output
+ * @brief 		- Returns the current comparator output
+ * @param [out] - state: pointer to the variable that will return the output @ref AC_OUTPUT_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype AC_Read_Output(uint8 *state){
+	Std_Returntype ret = RET_OK;
+	if(NULL == state)
+		ret = RET_NOT_OK;
+	else
+		*state = AC->ACSR.ACO;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- AC_SetCallBack
+ * @brief 		- Sets the callback function of the comparator interrupt
+ * @param [in] 	- pf_callback: pointer to the function to be set as callback
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype AC_SetCallBack(void (*pf_callback)(void)){
+	Std_Returntype ret = RET_OK;
+	if(NULL == pf_callback)
+		ret = RET_NOT_OK;
+	else
+		AC_Callback = pf_callback;
+	return ret;
+}
+
+/* ANA_COMP_ISR */
+void __vector_18(void) __attribute__((signal));
+void __vector_18(void){
+	if(AC_Callback)
+		AC_Callback();
+}
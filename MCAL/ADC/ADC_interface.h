@@ -23,8 +23,36 @@ typedef struct{
 	uint8 prescaler;			// @ref ADC_PRESCALE_define
 	uint8 interrupt_status;		// @ref ADC_INTERRUPT_define
 	void (*pf_callback)(void);
+	uint8 data_width;			// @ref ADC_DATA_WIDTH_define
 }ADC_cfg;
 
+/* Linear calibration of one channel: value = value_offset + (((raw - raw_offset) * gain_q16) >> 16) */
+typedef struct{
+	sint16 raw_offset;		// raw count at the calibration origin
+	sint16 value_offset;	// engineering value at raw_offset
+	sint32 gain_q16;		// engineering units per raw count in Q16, |gain_q16| < ADC_GAIN_Q16_LIMIT
+}ADC_Calibration_t;
+
+/* Out-of-range window of one channel, readings must come back hysteresis counts
+ * inside the window before the channel is reported inside again */
+typedef struct{
+	uint16 low;					// lower threshold (raw 10-bit)
+	uint16 high;				// upper threshold (raw 10-bit)
+	uint16 hysteresis;			// re-arm distance (raw 10-bit)
+}ADC_Window_t;
+
+typedef struct{
+	volatile uint16	result;		// raw 10-bit result, valid in ADC_HANDLE_READY state
+	volatile uint8	state;		// @ref ADC_HANDLE_STATE_define
+	uint8			channel;	// @ref ADC_PIN_define
+}ADC_Handle_t;
+
+typedef struct{
+	uint8 	channel;			// @ref ADC_PIN_define
+	uint8 	direction;			// @ref ADC_WINDOW_EVENT_define
+	uint16 	value;				// raw 10-bit reading that caused the event
+}ADC_Window_Event_t;
+
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
@@ -32,6 +60,15 @@ typedef struct{
 #define ADC_VREF_VOLTAGE_MV		5000UL
 #define ADC_RESOLUTION			1024UL
 
+/* Default calibration converts 10-bit raw counts to millivolts */
+#define ADC_DEFAULT_GAIN_Q16	((sint32)((ADC_VREF_VOLTAGE_MV << 16) / ADC_RESOLUTION))
+
+/* A 10-bit difference times the gain must fit in sint32 */
+#define ADC_GAIN_Q16_LIMIT		(1L << 21)
+
+/* Size of the calibration table stored in EEPROM (ADC_PIN_MAX records) */
+#define ADC_CALIBRATION_EEPROM_SIZE	(ADC_PIN_MAX * sizeof(ADC_Calibration_t))
+
 // @ref ADC_REFERENCE_define
 #define ADC_REFERENCE_AREF		(0)
 #define ADC_REFERENCE_AVCC		(0x40)
@@ -41,11 +78,17 @@ typedef struct{
 #define ADC_ADJUST_RIGHT		(0)
 #define ADC_ADJUST_LEFT			(0x20)
 
+// @ref ADC_DATA_WIDTH_define
+#define ADC_DATA_WIDTH_10BIT	(0)
+#define ADC_DATA_WIDTH_8BIT		(1)	/* Forces left adjustment, only ADCH is read */
+
 // @ref ADC_INTERRUPT_define
 #define ADC_INTERRUPT_ENABLE	(0x08)
 #define ADC_INTERRUPT_DISABLE	(0)
 
 // @ref ADC_PRESCALE_define
+/* 10-bit accuracy needs an ADC clock of 50-200 KHz (PRESCALE_64/128 at 8-16 MHz),
+ * 8-bit mode tolerates up to 1 MHz (PRESCALE_8 at 8 MHz, PRESCALE_16 at 16 MHz) */
 #define ADC_PRESCALE_2			1
 #define ADC_PRESCALE_4			2
 #define ADC_PRESCALE_8			3
@@ -54,6 +97,36 @@ typedef struct{
 #define ADC_PRESCALE_64			6
 #define ADC_PRESCALE_128		7
 
+// @ref ADC_HANDLE_STATE_define
+#define ADC_HANDLE_IDLE			0
+#define ADC_HANDLE_BUSY			1
+#define ADC_HANDLE_READY		2
+
+// @ref ADC_WINDOW_EVENT_define
+#define ADC_WINDOW_INSIDE		0
+#define ADC_WINDOW_BELOW		1
+#define ADC_WINDOW_ABOVE		2
+
+/* Number of pending window events, must be a power of 2 */
+#define ADC_WINDOW_QUEUE_SIZE	8U
+
+// @ref ADC_BINDING_define
+#define ADC_BINDING_RUNTIME		0	/* driver defines the vector, callback set at runtime */
+#define ADC_BINDING_STATIC		1	/* application defines the vector with ADC_BIND_ISR */
+
+/* Override with -DADC_BINDING=1 for every translation unit. A static binding replaces the
+ * driver ISR, so ADC_Convert_Sleep, window monitoring and interrupt mode handles are rejected */
+#ifndef ADC_BINDING
+#define ADC_BINDING				ADC_BINDING_RUNTIME
+#endif
+
+#define ADC_VECTOR				__vector_16
+
+/* Defines the ADC vector, a static inline handler in the same file is inlined into it */
+#define ADC_BIND_ISR(handler)								\
+	void ADC_VECTOR(void) __attribute__((signal));			\
+	void ADC_VECTOR(void){ handler(); }
+
 // @ref ADC_PIN_define
 #define ADC_PIN_0				0
 #define ADC_PIN_1				1
@@ -65,6 +138,34 @@ typedef struct{
 #define ADC_PIN_7				7
 #define ADC_PIN_MAX				8
 
+// @ref ADC_CHANNEL_define (single ended pins use @ref ADC_PIN_define)
+/* Differential channels: ADC_DIFF_<positive>_<negative>_<gain>, results are signed (-512 -> 511) */
+#define ADC_DIFF_ADC0_ADC0_10X		0x08
+#define ADC_DIFF_ADC1_ADC0_10X		0x09
+#define ADC_DIFF_ADC0_ADC0_200X		0x0A
+#define ADC_DIFF_ADC1_ADC0_200X		0x0B
+#define ADC_DIFF_ADC2_ADC2_10X		0x0C
+#define ADC_DIFF_ADC3_ADC2_10X		0x0D
+#define ADC_DIFF_ADC2_ADC2_200X		0x0E
+#define ADC_DIFF_ADC3_ADC2_200X		0x0F
+#define ADC_DIFF_ADC0_ADC1_1X		0x10
+#define ADC_DIFF_ADC1_ADC1_1X		0x11
+#define ADC_DIFF_ADC2_ADC1_1X		0x12
+#define ADC_DIFF_ADC3_ADC1_1X		0x13
+#define ADC_DIFF_ADC4_ADC1_1X		0x14
+#define ADC_DIFF_ADC5_ADC1_1X		0x15
+#define ADC_DIFF_ADC6_ADC1_1X		0x16
+#define ADC_DIFF_ADC7_ADC1_1X		0x17
+#define ADC_DIFF_ADC0_ADC2_1X		0x18
+#define ADC_DIFF_ADC1_ADC2_1X		0x19
+#define ADC_DIFF_ADC2_ADC2_1X		0x1A
+#define ADC_DIFF_ADC3_ADC2_1X		0x1B
+#define ADC_DIFF_ADC4_ADC2_1X		0x1C
+#define ADC_DIFF_ADC5_ADC2_1X		0x1D
+#define ADC_CHANNEL_BANDGAP			0x1E	/* 1.22V internal reference */
+#define ADC_CHANNEL_GND				0x1F
+#define ADC_CHANNEL_MAX				0x20
+
 /*
  * =============================================
  * APIs Supported by "ADC"
@@ -91,6 +192,221 @@ Std_Returntype ADC_Init(ADC_cfg *cfg);
  */
 Std_Returntype ADC_Start_Conversion(uint8 PIN, uint16 *buffer, polling_t poll_status);
 
+/**=============================================
+ * @Fn			- ADC_Start_Conversion_8Bit
+ * @brief 		- This function starts an 8-bit conversion on specific ADC pin, only ADCH is read
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- buffer: Pointer to the buffer that will return the conversion data if polling is enabled
+ * @param [in] 	- poll_status: specifies if polling is used or not
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- ADC must be initialized with ADC_DATA_WIDTH_8BIT
+ */
+Std_Returntype ADC_Start_Conversion_8Bit(uint8 PIN, uint8 *buffer, polling_t poll_status);
+
+/**=============================================
+ * @Fn			- ADC_Read_Burst_8Bit
+ * @brief 		- Fills a buffer with back-to-back 8-bit samples using free running mode
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [out] - buffer: Pointer to the buffer that will hold the samples
+ * @param [in] 	- length: number of samples to be taken
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- ADC must be initialized with ADC_DATA_WIDTH_8BIT, the ADC interrupt is masked during the burst
+ */
+Std_Returntype ADC_Read_Burst_8Bit(uint8 PIN, uint8 *buffer, uint16 length);
+
+/**=============================================
+ * @Fn			- ADC_Convert_Channel
+ * @brief 		- Converts any multiplexer channel, including differential, gain and bandgap channels
+ * @param [in] 	- channel: specifies the channel @ref ADC_PIN_define or @ref ADC_CHANNEL_define
+ * @param [out] - buffer: pointer to the variable that will return the conversion data, signed for differential channels
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Blocking, the first conversion after switching to a differential or bandgap channel is discarded to let it settle.
+ * 				  Gain channels need an ADC clock of 200 KHz or lower
+ */
+Std_Returntype ADC_Convert_Channel(uint8 channel, sint16 *buffer);
+
+/**=============================================
+ * @Fn			- ADC_Start
+ * @brief 		- Starts a conversion on specific ADC pin and returns immediately
+ * @param [in] 	- handle: pointer to the handle that will receive the result
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Fails if another conversion is ongoing, works with ADC interrupt enabled or disabled
+ */
+Std_Returntype ADC_Start(ADC_Handle_t *handle, uint8 PIN);
+
+/**=============================================
+ * @Fn			- ADC_Poll
+ * @brief 		- Checks without blocking if the conversion of a handle is complete
+ * @param [in] 	- handle: pointer to the handle passed to ADC_Start
+ * @param [out] - buffer: pointer to the variable that will return the conversion data when ready
+ * @retval 		- return RET_OK if the result was returned, and returns RET_NOT_OK if it is not ready yet or an error happened
+ * Note			- The handle goes back to idle once its result is returned
+ */
+Std_Returntype ADC_Poll(ADC_Handle_t *handle, uint16 *buffer);
+
+/**=============================================
+ * @Fn			- ADC_Wait
+ * @brief 		- Waits for the conversion of a handle with a bounded timeout
+ * @param [in] 	- handle: pointer to the handle passed to ADC_Start
+ * @param [out] - buffer: pointer to the variable that will return the conversion data
+ * @param [in] 	- timeout_us: number of 1 us polling steps before giving up
+ * @retval 		- return RET_OK if the result was returned, and returns RET_NOT_OK on timeout or if an error happened
+ * Note			- The timeout is a lower bound, each step adds the ADC_Poll call to the 1 us delay
+ * 				  (a few us more per step at low F_CPU). On timeout the handle stays busy and can
+ * 				  still be polled later
+ */
+Std_Returntype ADC_Wait(ADC_Handle_t *handle, uint16 *buffer, uint16 timeout_us);
+
+/**=============================================
+ * @Fn			- ADC_Convert_Sleep
+ * @brief 		- Converts an ADC pin while the CPU sleeps in ADC Noise Reduction mode
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [out] - buffer: Pointer to the buffer that will return the conversion data
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Enables global interrupts, the ADC interrupt wakes the core when the result is ready.
+ * 				  Rejected while a handle, a conversion, window monitoring or the comparator uses the ADC
+ */
+Std_Returntype ADC_Convert_Sleep(uint8 PIN, uint16 *buffer);
+
+/**=============================================
+ * @Fn			- ADC_Scan_Sleep
+ * @brief 		- Converts a sequence of ADC pins, each one in ADC Noise Reduction sleep
+ * @param [in] 	- pins: Pointer to the array of pins to be converted @ref ADC_PIN_define
+ * @param [out] - buffer: Pointer to the array that will return the conversion data of each pin
+ * @param [in] 	- count: number of pins in the sequence
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Every conversion starts on sleep entry, which keeps the sampling jitter low.
+ * 				  Rejected while a handle, a conversion, window monitoring or the comparator uses the ADC
+ */
+Std_Returntype ADC_Scan_Sleep(const uint8 *pins, uint16 *buffer, uint8 count);
+
+/**=============================================
+ * @Fn			- ADC_Set_Calibration
+ * @brief 		- Sets the offset/gain calibration of a channel
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- calibration: pointer to the channel calibration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Channels default to millivolts using ADC_VREF_VOLTAGE_MV. Rejected when
+ * 				  |gain_q16| >= ADC_GAIN_Q16_LIMIT or raw_offset is not a 10-bit reading
+ */
+Std_Returntype ADC_Set_Calibration(uint8 PIN, const ADC_Calibration_t *calibration);
+
+/**=============================================
+ * @Fn			- ADC_Calibrate_Two_Point
+ * @brief 		- Computes a channel calibration from two known (raw, value) points
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- raw_low: raw reading at the first point
+ * @param [in] 	- value_low: engineering value at the first point
+ * @param [in] 	- raw_high: raw reading at the second point
+ * @param [in] 	- value_high: engineering value at the second point
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The division is done once here, conversions only multiply and shift.
+ * 				  Rejected when the slope needs |gain_q16| >= ADC_GAIN_Q16_LIMIT
+ */
+Std_Returntype ADC_Calibrate_Two_Point(uint8 PIN, uint16 raw_low, sint16 value_low, uint16 raw_high, sint16 value_high);
+
+/**=============================================
+ * @Fn			- ADC_Load_Calibration
+ * @brief 		- Loads the calibration table of all channels from EEPROM
+ * @param [in] 	- eeprom_address: EEPROM address of the table (ADC_CALIBRATION_EEPROM_SIZE bytes)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Erased records (all 0xFF) keep the current calibration of their channel,
+ * 				  invalid records (see ADC_Set_Calibration) are skipped and RET_NOT_OK is returned
+ */
+Std_Returntype ADC_Load_Calibration(uint16 eeprom_address);
+
+/**=============================================
+ * @Fn			- ADC_Store_Calibration
+ * @brief 		- Stores the calibration table of all channels in EEPROM
+ * @param [in] 	- eeprom_address: EEPROM address of the table (ADC_CALIBRATION_EEPROM_SIZE bytes)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Blocks for the EEPROM write time of the changed bytes
+ */
+Std_Returntype ADC_Store_Calibration(uint16 eeprom_address);
+
+/**=============================================
+ * @Fn			- ADC_Convert_Units
+ * @brief 		- Converts a raw 10-bit reading to engineering units using the channel calibration
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- raw: 10-bit raw reading (8-bit readings must be shifted left by 2)
+ * @param [out] - value: pointer to the variable that will return the converted value
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or raw is not below ADC_RESOLUTION
+ * Note			- One 32-bit multiply and shift, no division
+ */
+Std_Returntype ADC_Convert_Units(uint8 PIN, uint16 raw, sint32 *value);
+
+/**=============================================
+ * @Fn			- ADC_Window_Set
+ * @brief 		- Enables window monitoring of a channel
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- window: pointer to the channel window configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The channel starts as inside the window
+ */
+Std_Returntype ADC_Window_Set(uint8 PIN, const ADC_Window_t *window);
+
+/**=============================================
+ * @Fn			- ADC_Window_Disable
+ * @brief 		- Removes a channel from window monitoring
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ADC_Window_Disable(uint8 PIN);
+
+/**=============================================
+ * @Fn			- ADC_Window_Start_Monitor
+ * @brief 		- Starts interrupt driven round-robin conversions over the monitored channels
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Enables the ADC and global interrupts, the ADC must not be used for other conversions meanwhile
+ */
+Std_Returntype ADC_Window_Start_Monitor(void);
+
+/**=============================================
+ * @Fn			- ADC_Window_Stop_Monitor
+ * @brief 		- Stops the window monitoring after the ongoing conversion
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The ADC interrupt state set by ADC_Init is restored
+ */
+Std_Returntype ADC_Window_Stop_Monitor(void);
+
+/**=============================================
+ * @Fn			- ADC_Window_Get_Event
+ * @brief 		- Returns the oldest window crossing event without blocking
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if no event is pending
+ * Note			- None
+ */
+Std_Returntype ADC_Window_Get_Event(ADC_Window_Event_t *event);
+
+/**=============================================
+ * @Fn			- ADC_Window_Wait_Event
+ * @brief 		- Sleeps in idle mode until a window crossing event is available
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Monitoring must have been started
+ */
+Std_Returntype ADC_Window_Wait_Event(ADC_Window_Event_t *event);
+
+/**=============================================
+ * @Fn			- ADC_Mux_Lock
+ * @brief 		- Lends the ADC multiplexer to the analog comparator
+ * @param [in] 	- PIN: ADC pin to be routed to the comparator negative input @ref ADC_PIN_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Fails while a conversion or window monitoring is ongoing, the ADC is disabled until ADC_Mux_Unlock
+ */
+Std_Returntype ADC_Mux_Lock(uint8 PIN);
+
+/**=============================================
+ * @Fn			- ADC_Mux_Unlock
+ * @brief 		- Gives the ADC multiplexer back to the ADC and restores its enable state
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ADC_Mux_Unlock(void);
+
 /**=============================================
  * @Fn			- ADC_SetCallBack
  * @brief 		- Sets the callback function
@@ -8,11 +8,113 @@
 /*************************************************************************/
 
 #include "ADC_interface.h"
+#include "../EEPROM/EEPROM_interface.h"
+#include <util/delay.h>
+
+/* Features that depend on the driver ISR */
+#if (ADC_BINDING_STATIC == ADC_BINDING)
+#define ADC_DRIVER_ISR		0
+#else
+#define ADC_DRIVER_ISR		1
+#endif
 
 static void (*ADC_Callback)(void);
 
 static ADC_cfg g_ADC_CFG;
 
+static volatile uint8 ADC_Conversion_Complete;
+
+static ADC_Handle_t *volatile ADC_Active_Handle;
+
+/* Set while the analog comparator borrows the ADC multiplexer */
+static volatile uint8 ADC_Mux_Locked;
+static uint8 ADC_Mux_Saved_Enable;
+
+static ADC_Window_t ADC_Windows[ADC_PIN_MAX];
+static uint8 ADC_Window_Zone[ADC_PIN_MAX];
+static volatile uint8 ADC_Window_Mask;
+static volatile uint8 ADC_Window_Monitor_Active;
+static ADC_Window_Event_t ADC_Window_Queue[ADC_WINDOW_QUEUE_SIZE];
+static volatile uint8 ADC_Window_Queue_Head;
+static volatile uint8 ADC_Window_Queue_Tail;
+
+/* Keeps the multiply of ADC_Convert_Units inside sint32 */
+static uint8 ADC_Calibration_Valid(const ADC_Calibration_t *calibration){
+	return ((calibration->raw_offset >= 0) && (calibration->raw_offset < (sint16)ADC_RESOLUTION) &&
+			(calibration->gain_q16 < ADC_GAIN_Q16_LIMIT) && (calibration->gain_q16 > -ADC_GAIN_Q16_LIMIT));
+}
+
+static ADC_Calibration_t ADC_Calibration[ADC_PIN_MAX] = {
+		{0, 0, ADC_DEFAULT_GAIN_Q16}, {0, 0, ADC_DEFAULT_GAIN_Q16},
+		{0, 0, ADC_DEFAULT_GAIN_Q16}, {0, 0, ADC_DEFAULT_GAIN_Q16},
+		{0, 0, ADC_DEFAULT_GAIN_Q16}, {0, 0, ADC_DEFAULT_GAIN_Q16},
+		{0, 0, ADC_DEFAULT_GAIN_Q16}, {0, 0, ADC_DEFAULT_GAIN_Q16}
+};
+
+static uint16 ADC_Read_Result(void){
+	uint16 result;
+	/* 16-bit access reads ADCL before ADCH as required by the hardware */
+	if(ADC_ADJUST_LEFT == g_ADC_CFG.data_adjust)
+		result = (ADC->ADCLH.ADCLH_REG >> 6);
+	else
+		result = ADC->ADCLH.ADCLH_REG;
+	return result;
+}
+
+/* Starts a conversion and busy waits for it, the caller masks the ADC interrupt */
+static uint16 ADC_Convert_Blocking(void){
+	ADC->ADCSRA.ADSC = 1;
+	while(0 == ADC->ADCSRA.ADIF); // while flag is not set
+	ADC->ADCSRA.ADIF = 1; // Clear flag
+	return ADC_Read_Result();
+}
+
+/* A handle, a running conversion, window monitoring or the analog comparator owns the ADC */
+static uint8 ADC_Is_Busy(void){
+	return ((NULL != ADC_Active_Handle) || (ADC->ADCSRA.ADSC) || (ADC_Window_Monitor_Active) || (ADC_Mux_Locked));
+}
+
+/* Called from the ISR, updates the zone of the converted channel and posts an event on crossings */
+static void ADC_Window_Process(uint8 channel, uint16 value){
+	const ADC_Window_t *window = &ADC_Windows[channel];
+	uint8 zone = ADC_Window_Zone[channel];
+	uint8 new_zone = zone;
+	uint8 next_head;
+
+	if(value < window->low)
+		new_zone = ADC_WINDOW_BELOW;
+	else if(value > window->high)
+		new_zone = ADC_WINDOW_ABOVE;
+	else if((ADC_WINDOW_BELOW == zone) && (value >= (window->low + window->hysteresis)))
+		new_zone = ADC_WINDOW_INSIDE;
+	else if((ADC_WINDOW_ABOVE == zone) && ((value + window->hysteresis) <= window->high))
+		new_zone = ADC_WINDOW_INSIDE;
+	else{ /* Stay in the current zone */ }
+
+	if(new_zone != zone){
+		ADC_Window_Zone[channel] = new_zone;
+		next_head = (ADC_Window_Queue_Head + 1) & (ADC_WINDOW_QUEUE_SIZE - 1);
+		/* Drop the event if the application did not drain the queue */
+		if(next_head != ADC_Window_Queue_Tail){
+			ADC_Window_Queue[ADC_Window_Queue_Head].channel = channel;
+			ADC_Window_Queue[ADC_Window_Queue_Head].direction = new_zone;
+			ADC_Window_Queue[ADC_Window_Queue_Head].value = value;
+			ADC_Window_Queue_Head = next_head;
+		}
+	}
+}
+
+/* Returns the monitored channel that follows the given one */
+static uint8 ADC_Window_Next_Channel(uint8 channel){
+	uint8 index;
+	for(index = 0; index < ADC_PIN_MAX; index++){
+		channel = (channel + 1) & (ADC_PIN_MAX - 1);
+		if((ADC_Window_Mask >> channel) & 0x01)
+			break;
+	}
+	return channel;
+}
+
 /**=============================================
  * @Fn			- ADC_Init
  * @brief 		- This function configures and enable the ADC
@@ -29,11 +131,15 @@ Std_Returntype ADC_Init(ADC_cfg *cfg){
 		/* Save configuration in global variable */
 		g_ADC_CFG = *cfg;
 
+		/* 8-bit mode only reads ADCH, so the result must be left adjusted */
+		if(ADC_DATA_WIDTH_8BIT == cfg->data_width)
+			g_ADC_CFG.data_adjust = ADC_ADJUST_LEFT;
+
 		/* Disable ADC */
 		ADC->ADCSRA.ADEN = 0;
 
 		/* ADMUX Register configuration */
-		temp_reg = cfg->reference_voltage | cfg->data_adjust;
+		temp_reg = cfg->reference_voltage | g_ADC_CFG.data_adjust;
 		ADC->ADMUX.ADMUX_REG = temp_reg;
 
 		/* ADCSRA Register configuration */
@@ -64,7 +170,7 @@ Std_Returntype ADC_Init(ADC_cfg *cfg){
 Std_Returntype ADC_Start_Conversion(uint8 PIN, uint16 *buffer, polling_t poll_status){
 	Std_Returntype ret = RET_OK;
 	/* Select the ADC pin */
-	if(ADC_PIN_MAX > PIN)
+	if((ADC_PIN_MAX > PIN) && (0 == ADC_Mux_Locked))
 		ADC->ADMUX.MUX = PIN;
 	else
 		ret |= RET_NOT_OK;
@@ -78,10 +184,7 @@ Std_Returntype ADC_Start_Conversion(uint8 PIN, uint16 *buffer, polling_t poll_st
 		if(pollingEnable == poll_status){
 			while(0 == ADC->ADCSRA.ADIF); // while flag is not set
 			ADC->ADCSRA.ADIF = 1; // Clear flag
-			if(ADC_ADJUST_LEFT == g_ADC_CFG.data_adjust)
-				*buffer = ((ADC->ADCLH.ADCL + (ADC->ADCLH.ADCH << 8)) >> 6);
-			else
-				*buffer = (ADC->ADCLH.ADCL | (ADC->ADCLH.ADCH << 8));
+			*buffer = ADC_Read_Result();
 		}
 		else{ /* Do Nothing */ }
 	}
@@ -91,6 +194,523 @@ Std_Returntype ADC_Start_Conversion(uint8 PIN, uint16 *buffer, polling_t poll_st
 	return ret;
 }
 
+/**=============================================
+ * @Fn			- ADC_Start_Conversion_8Bit
+ * @brief 		- This function starts an 8-bit conversion on specific ADC pin, only ADCH is read
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- buffer: Pointer to the buffer that will return the conversion data if polling is enabled
+ * @param [in] 	- poll_status: specifies if polling is used or not
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- ADC must be initialized with ADC_DATA_WIDTH_8BIT
+ */
+Std_Returntype ADC_Start_Conversion_8Bit(uint8 PIN, uint8 *buffer, polling_t poll_status){
+	Std_Returntype ret = RET_OK;
+	if((ADC_PIN_MAX <= PIN) || (ADC_DATA_WIDTH_8BIT != g_ADC_CFG.data_width) || (ADC_Mux_Locked))
+		ret = RET_NOT_OK;
+	else if((pollingEnable == poll_status) && (NULL == buffer))
+		ret = RET_NOT_OK;
+	else{
+		/* Select the ADC pin and start conversion */
+		ADC->ADMUX.MUX = PIN;
+		ADC->ADCSRA.ADSC = 1;
+
+		/* Poll if polling is enabled */
+		if(pollingEnable == poll_status){
+			while(0 == ADC->ADCSRA.ADIF); // while flag is not set
+			ADC->ADCSRA.ADIF = 1; // Clear flag
+			*buffer = ADC->ADCLH.ADCH;
+		}
+		else{ /* Do Nothing */ }
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Read_Burst_8Bit
+ * @brief 		- Fills a buffer with back-to-back 8-bit samples using free running mode
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [out] - buffer: Pointer to the buffer that will hold the samples
+ * @param [in] 	- length: number of samples to be taken
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- ADC must be initialized with ADC_DATA_WIDTH_8BIT, the ADC interrupt is masked during the burst
+ */
+Std_Returntype ADC_Read_Burst_8Bit(uint8 PIN, uint8 *buffer, uint16 length){
+	Std_Returntype ret = RET_OK;
+	uint16 index;
+	uint8 interrupt_state;
+	if((NULL == buffer) || (ADC_PIN_MAX <= PIN) || (ADC_DATA_WIDTH_8BIT != g_ADC_CFG.data_width) || (ADC_Mux_Locked))
+		ret = RET_NOT_OK;
+	else{
+		/* Mask the ADC interrupt so the ISR does not consume the flag */
+		interrupt_state = ADC->ADCSRA.ADIE;
+		ADC->ADCSRA.ADIE = 0;
+
+		/* Select the pin and start free running conversions */
+		ADC->ADMUX.MUX = PIN;
+		ADC->SFIOR.ADTS = 0;
+		ADC->ADCSRA.ADATE = 1;
+		ADC->ADCSRA.ADSC = 1;
+
+		for(index = 0; index < length; index++){
+			while(0 == ADC->ADCSRA.ADIF); // while flag is not set
+			ADC->ADCSRA.ADIF = 1; // Clear flag
+			buffer[index] = ADC->ADCLH.ADCH;
+		}
+
+		/* Stop free running mode and restore the interrupt state */
+		ADC->ADCSRA.ADATE = 0;
+		ADC->ADCSRA.ADIF = 1;
+		ADC->ADCSRA.ADIE = interrupt_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Convert_Channel
+ * @brief 		- Converts any multiplexer channel, including differential, gain and bandgap channels
+ * @param [in] 	- channel: specifies the channel @ref ADC_PIN_define or @ref ADC_CHANNEL_define
+ * @param [out] - buffer: pointer to the variable that will return the conversion data, signed for differential channels
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Blocking, the first conversion after switching to a differential or bandgap channel is discarded to let it settle.
+ * 				  Gain channels need an ADC clock of 200 KHz or lower
+ */
+Std_Returntype ADC_Convert_Channel(uint8 channel, sint16 *buffer){
+	Std_Returntype ret = RET_OK;
+	uint8 interrupt_state;
+	uint16 raw;
+	if((NULL == buffer) || (ADC_CHANNEL_MAX <= channel))
+		ret = RET_NOT_OK;
+	else if(ADC_Is_Busy())
+		ret = RET_NOT_OK;
+	else{
+		/* Mask the ADC interrupt so the ISR does not consume the flag */
+		interrupt_state = ADC->ADCSRA.ADIE;
+		ADC->ADCSRA.ADIE = 0;
+
+		if(ADC->ADMUX.MUX != channel){
+			ADC->ADMUX.MUX = channel;
+			/* Gain stages and the bandgap need time to settle after switching */
+			if(ADC_PIN_MAX <= channel)
+				(void)ADC_Convert_Blocking();
+		}
+		raw = ADC_Convert_Blocking();
+
+		/* Differential results are 10-bit two's complement */
+		if((ADC_PIN_MAX <= channel) && (ADC_CHANNEL_BANDGAP > channel) && (raw & 0x200))
+			*buffer = (sint16)raw - 1024;
+		else
+			*buffer = (sint16)raw;
+
+		ADC->ADCSRA.ADIE = interrupt_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Start
+ * @brief 		- Starts a conversion on specific ADC pin and returns immediately
+ * @param [in] 	- handle: pointer to the handle that will receive the result
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Fails if another conversion is ongoing, works with ADC interrupt enabled or disabled
+ */
+Std_Returntype ADC_Start(ADC_Handle_t *handle, uint8 PIN){
+	Std_Returntype ret = RET_OK;
+	if((NULL == handle) || (ADC_PIN_MAX <= PIN))
+		ret = RET_NOT_OK;
+	else if(ADC_Is_Busy())
+		ret = RET_NOT_OK;
+	else if((0 == ADC_DRIVER_ISR) && (ADC->ADCSRA.ADIE))
+		ret = RET_NOT_OK;
+	else{
+		handle->channel = PIN;
+		handle->state = ADC_HANDLE_BUSY;
+		ADC_Active_Handle = handle;
+		ADC->ADMUX.MUX = PIN;
+		ADC->ADCSRA.ADSC = 1;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Poll
+ * @brief 		- Checks without blocking if the conversion of a handle is complete
+ * @param [in] 	- handle: pointer to the handle passed to ADC_Start
+ * @param [out] - buffer: pointer to the variable that will return the conversion data when ready
+ * @retval 		- return RET_OK if the result was returned, and returns RET_NOT_OK if it is not ready yet or an error happened
+ * Note			- The handle goes back to idle once its result is returned
+ */
+Std_Returntype ADC_Poll(ADC_Handle_t *handle, uint16 *buffer){
+	Std_Returntype ret = RET_OK;
+	if((NULL == handle) || (NULL == buffer))
+		ret = RET_NOT_OK;
+	else{
+		/* Without the ADC interrupt the flag is checked here instead of the ISR */
+		if((ADC_HANDLE_BUSY == handle->state) && (0 == ADC->ADCSRA.ADIE) && (ADC->ADCSRA.ADIF)){
+			ADC->ADCSRA.ADIF = 1; // Clear flag
+			handle->result = ADC_Read_Result();
+			handle->state = ADC_HANDLE_READY;
+			ADC_Active_Handle = NULL;
+		}
+
+		if(ADC_HANDLE_READY == handle->state){
+			*buffer = handle->result;
+			handle->state = ADC_HANDLE_IDLE;
+		}
+		else
+			ret = RET_NOT_OK;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Wait
+ * @brief 		- Waits for the conversion of a handle with a bounded timeout
+ * @param [in] 	- handle: pointer to the handle passed to ADC_Start
+ * @param [out] - buffer: pointer to the variable that will return the conversion data
+ * @param [in] 	- timeout_us: number of 1 us polling steps before giving up
+ * @retval 		- return RET_OK if the result was returned, and returns RET_NOT_OK on timeout or if an error happened
+ * Note			- The timeout is a lower bound, each step adds the ADC_Poll call to the 1 us delay
+ * 				  (a few us more per step at low F_CPU). On timeout the handle stays busy and can
+ * 				  still be polled later
+ */
+Std_Returntype ADC_Wait(ADC_Handle_t *handle, uint16 *buffer, uint16 timeout_us){
+	Std_Returntype ret = RET_NOT_OK;
+	if((NULL != handle) && (NULL != buffer) && (ADC_HANDLE_IDLE != handle->state)){
+		ret = ADC_Poll(handle, buffer);
+		while((RET_OK != ret) && (timeout_us > 0)){
+			_delay_us(1);
+			timeout_us--;
+			ret = ADC_Poll(handle, buffer);
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Convert_Sleep
+ * @brief 		- Converts an ADC pin while the CPU sleeps in ADC Noise Reduction mode
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [out] - buffer: Pointer to the buffer that will return the conversion data
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Enables global interrupts, the ADC interrupt wakes the core when the result is ready.
+ * 				  Rejected while a handle, a conversion, window monitoring or the comparator uses the ADC
+ */
+Std_Returntype ADC_Convert_Sleep(uint8 PIN, uint16 *buffer){
+	Std_Returntype ret = RET_OK;
+	uint8 interrupt_state;
+	if((NULL == buffer) || (ADC_PIN_MAX <= PIN) || ADC_Is_Busy() || (0 == ADC_DRIVER_ISR))
+		ret = RET_NOT_OK;
+	else{
+		/* The ADC interrupt is needed to wake the core up */
+		interrupt_state = ADC->ADCSRA.ADIE;
+		ADC->ADMUX.MUX = PIN;
+		ADC_Conversion_Complete = 0;
+		ADC->ADCSRA.ADIE = 1;
+
+		/* Entering ADC Noise Reduction mode starts the conversion */
+		EXTI->MCUCR.SM = SLEEP_MODE_ADC_NOISE_REDUCTION;
+		EXTI->MCUCR.SE = 1;
+		GLOBAL_INTERRUPT_DISABLE();
+		while(0 == ADC_Conversion_Complete){
+			/* Other wake-up sources put the core back to sleep, the conversion keeps running */
+			CPU_ENABLE_INTERRUPT_AND_SLEEP();
+			GLOBAL_INTERRUPT_DISABLE();
+		}
+		GLOBAL_INTERRUPT_ENABLE();
+		EXTI->MCUCR.SE = 0;
+
+		*buffer = ADC_Read_Result();
+		ADC->ADCSRA.ADIE = interrupt_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Scan_Sleep
+ * @brief 		- Converts a sequence of ADC pins, each one in ADC Noise Reduction sleep
+ * @param [in] 	- pins: Pointer to the array of pins to be converted @ref ADC_PIN_define
+ * @param [out] - buffer: Pointer to the array that will return the conversion data of each pin
+ * @param [in] 	- count: number of pins in the sequence
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Every conversion starts on sleep entry, which keeps the sampling jitter low.
+ * 				  Rejected while a handle, a conversion, window monitoring or the comparator uses the ADC
+ */
+Std_Returntype ADC_Scan_Sleep(const uint8 *pins, uint16 *buffer, uint8 count){
+	Std_Returntype ret = RET_OK;
+	uint8 index;
+	if((NULL == pins) || (NULL == buffer) || ADC_Is_Busy())
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; (index < count) && (RET_OK == ret); index++)
+			ret |= ADC_Convert_Sleep(pins[index], &buffer[index]);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Set_Calibration
+ * @brief 		- Sets the offset/gain calibration of a channel
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- calibration: pointer to the channel calibration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Channels default to millivolts using ADC_VREF_VOLTAGE_MV. Rejected when
+ * 				  |gain_q16| >= ADC_GAIN_Q16_LIMIT or raw_offset is not a 10-bit reading
+ */
+Std_Returntype ADC_Set_Calibration(uint8 PIN, const ADC_Calibration_t *calibration){
+	Std_Returntype ret = RET_OK;
+	if((NULL == calibration) || (ADC_PIN_MAX <= PIN) || !ADC_Calibration_Valid(calibration))
+		ret = RET_NOT_OK;
+	else
+		ADC_Calibration[PIN] = *calibration;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Calibrate_Two_Point
+ * @brief 		- Computes a channel calibration from two known (raw, value) points
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- raw_low: raw reading at the first point
+ * @param [in] 	- value_low: engineering value at the first point
+ * @param [in] 	- raw_high: raw reading at the second point
+ * @param [in] 	- value_high: engineering value at the second point
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The division is done once here, conversions only multiply and shift.
+ * 				  Rejected when the slope needs |gain_q16| >= ADC_GAIN_Q16_LIMIT
+ */
+Std_Returntype ADC_Calibrate_Two_Point(uint8 PIN, uint16 raw_low, sint16 value_low, uint16 raw_high, sint16 value_high){
+	Std_Returntype ret = RET_OK;
+	ADC_Calibration_t calibration;
+	sint32 delta = (sint32)value_high - value_low;
+	/* |delta| < 2^15 keeps delta * 65536 inside sint32, a larger one exceeds the gain limit anyway */
+	if((ADC_PIN_MAX <= PIN) || (raw_low >= raw_high) || (ADC_RESOLUTION <= raw_high) ||
+			(delta >= 32768L) || (delta <= -32768L))
+		ret = RET_NOT_OK;
+	else{
+		calibration.raw_offset = (sint16)raw_low;
+		calibration.value_offset = value_low;
+		calibration.gain_q16 = (delta * 65536L) / (sint32)(raw_high - raw_low);
+		ret = ADC_Set_Calibration(PIN, &calibration);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Load_Calibration
+ * @brief 		- Loads the calibration table of all channels from EEPROM
+ * @param [in] 	- eeprom_address: EEPROM address of the table (ADC_CALIBRATION_EEPROM_SIZE bytes)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Erased records (all 0xFF) keep the current calibration of their channel,
+ * 				  invalid records (see ADC_Set_Calibration) are skipped and RET_NOT_OK is returned
+ */
+Std_Returntype ADC_Load_Calibration(uint16 eeprom_address){
+	Std_Returntype ret = RET_OK;
+	Std_Returntype read_ret = RET_OK;
+	ADC_Calibration_t record;
+	uint8 index;
+	for(index = 0; (index < ADC_PIN_MAX) && (RET_OK == read_ret); index++){
+		read_ret = EEPROM_Read_Block(eeprom_address + (index * sizeof(ADC_Calibration_t)), (uint8*)&record, sizeof(ADC_Calibration_t));
+		if((RET_OK == read_ret) && (-1 != record.gain_q16)){
+			if(ADC_Calibration_Valid(&record))
+				ADC_Calibration[index] = record;
+			else
+				ret = RET_NOT_OK;
+		}
+	}
+	ret |= read_ret;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Store_Calibration
+ * @brief 		- Stores the calibration table of all channels in EEPROM
+ * @param [in] 	- eeprom_address: EEPROM address of the table (ADC_CALIBRATION_EEPROM_SIZE bytes)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Blocks for the EEPROM write time of the changed bytes
+ */
+Std_Returntype ADC_Store_Calibration(uint16 eeprom_address){
+	return EEPROM_Write_Block(eeprom_address, (const uint8*)ADC_Calibration, ADC_CALIBRATION_EEPROM_SIZE);
+}
+
+/**=============================================
+ * @Fn			- ADC_Convert_Units
+ * @brief 		- Converts a raw 10-bit reading to engineering units using the channel calibration
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- raw: 10-bit raw reading (8-bit readings must be shifted left by 2)
+ * @param [out] - value: pointer to the variable that will return the converted value
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or raw is not below ADC_RESOLUTION
+ * Note			- One 32-bit multiply and shift, no division
+ */
+Std_Returntype ADC_Convert_Units(uint8 PIN, uint16 raw, sint32 *value){
+	Std_Returntype ret = RET_OK;
+	const ADC_Calibration_t *calibration;
+	/* Out of range readings would overflow the multiply even within the gain limit */
+	if((NULL == value) || (ADC_PIN_MAX <= PIN) || (ADC_RESOLUTION <= raw))
+		ret = RET_NOT_OK;
+	else{
+		calibration = &ADC_Calibration[PIN];
+		/* Add half an LSB of the Q16 result before shifting to round to nearest */
+		*value = calibration->value_offset +
+				(((((sint32)raw - calibration->raw_offset) * calibration->gain_q16) + 0x8000L) >> 16);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Window_Set
+ * @brief 		- Enables window monitoring of a channel
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @param [in] 	- window: pointer to the channel window configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The channel starts as inside the window
+ */
+Std_Returntype ADC_Window_Set(uint8 PIN, const ADC_Window_t *window){
+	Std_Returntype ret = RET_OK;
+	if((NULL == window) || (ADC_PIN_MAX <= PIN) || (window->low > window->high))
+		ret = RET_NOT_OK;
+	else{
+		/* Keep the ISR away from a half written window */
+		ADC_Window_Mask &= ~(1U << PIN);
+		ADC_Windows[PIN] = *window;
+		ADC_Window_Zone[PIN] = ADC_WINDOW_INSIDE;
+		ADC_Window_Mask |= (1U << PIN);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Window_Disable
+ * @brief 		- Removes a channel from window monitoring
+ * @param [in] 	- PIN: specifies ADC pin @ref ADC_PIN_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ADC_Window_Disable(uint8 PIN){
+	Std_Returntype ret = RET_OK;
+	if(ADC_PIN_MAX <= PIN)
+		ret = RET_NOT_OK;
+	else
+		ADC_Window_Mask &= ~(1U << PIN);
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Window_Start_Monitor
+ * @brief 		- Starts interrupt driven round-robin conversions over the monitored channels
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Enables the ADC and global interrupts, the ADC must not be used for other conversions meanwhile
+ */
+Std_Returntype ADC_Window_Start_Monitor(void){
+	Std_Returntype ret = RET_OK;
+	if((0 == ADC_Window_Mask) || (ADC_Mux_Locked) || (0 == ADC_DRIVER_ISR))
+		ret = RET_NOT_OK;
+	else{
+		ADC_Window_Monitor_Active = 1;
+		ADC->ADMUX.MUX = ADC_Window_Next_Channel(ADC_PIN_MAX - 1);
+		ADC->ADCSRA.ADIE = 1;
+		GLOBAL_INTERRUPT_ENABLE();
+		ADC->ADCSRA.ADSC = 1;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Window_Stop_Monitor
+ * @brief 		- Stops the window monitoring after the ongoing conversion
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The ADC interrupt state set by ADC_Init is restored
+ */
+Std_Returntype ADC_Window_Stop_Monitor(void){
+	ADC_Window_Monitor_Active = 0;
+	while(ADC->ADCSRA.ADSC); // let the last conversion finish
+	ADC->ADCSRA.ADIE = (ADC_INTERRUPT_ENABLE == g_ADC_CFG.interrupt_status);
+	return RET_OK;
+}
+
+/**=============================================
+ * @Fn			- ADC_Window_Get_Event
+ * @brief 		- Returns the oldest window crossing event without blocking
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if no event is pending
+ * Note			- None
+ */
+Std_Returntype ADC_Window_Get_Event(ADC_Window_Event_t *event){
+	Std_Returntype ret = RET_OK;
+	uint8 tail = ADC_Window_Queue_Tail;
+	if((NULL == event) || (tail == ADC_Window_Queue_Head))
+		ret = RET_NOT_OK;
+	else{
+		*event = ADC_Window_Queue[tail];
+		ADC_Window_Queue_Tail = (tail + 1) & (ADC_WINDOW_QUEUE_SIZE - 1);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Window_Wait_Event
+ * @brief 		- Sleeps in idle mode until a window crossing event is available
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Monitoring must have been started
+ */
+Std_Returntype ADC_Window_Wait_Event(ADC_Window_Event_t *event){
+	Std_Returntype ret = RET_OK;
+	if((NULL == event) || (0 == ADC_Window_Monitor_Active))
+		ret = RET_NOT_OK;
+	else{
+		EXTI->MCUCR.SM = SLEEP_MODE_IDLE;
+		EXTI->MCUCR.SE = 1;
+		GLOBAL_INTERRUPT_DISABLE();
+		while(ADC_Window_Queue_Tail == ADC_Window_Queue_Head){
+			CPU_ENABLE_INTERRUPT_AND_SLEEP();
+			GLOBAL_INTERRUPT_DISABLE();
+		}
+		GLOBAL_INTERRUPT_ENABLE();
+		EXTI->MCUCR.SE = 0;
+		ret = ADC_Window_Get_Event(event);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Mux_Lock
+ * @brief 		- Lends the ADC multiplexer to the analog comparator
+ * @param [in] 	- PIN: ADC pin to be routed to the comparator negative input @ref ADC_PIN_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Fails while a conversion or window monitoring is ongoing, the ADC is disabled until ADC_Mux_Unlock
+ */
+Std_Returntype ADC_Mux_Lock(uint8 PIN){
+	Std_Returntype ret = RET_OK;
+	if((ADC_PIN_MAX <= PIN) || (NULL != ADC_Active_Handle) || (ADC->ADCSRA.ADSC) || (ADC_Window_Monitor_Active))
+		ret = RET_NOT_OK;
+	else{
+		ADC_Mux_Locked = 1;
+		/* The comparator can only use the multiplexer while the ADC is off */
+		ADC_Mux_Saved_Enable = ADC->ADCSRA.ADEN;
+		ADC->ADCSRA.ADEN = 0;
+		ADC->ADMUX.MUX = PIN;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- ADC_Mux_Unlock
+ * @brief 		- Gives the ADC multiplexer back to the ADC and restores its enable state
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype ADC_Mux_Unlock(void){
+	Std_Returntype ret = RET_OK;
+	if(0 == ADC_Mux_Locked)
+		ret = RET_NOT_OK;
+	else{
+		ADC->ADCSRA.ADEN = ADC_Mux_Saved_Enable;
+		ADC_Mux_Locked = 0;
+	}
+	return ret;
+}
+
 /**=============================================
  * @Fn			- ADC_SetCallBack
  * @brief 		- Sets the callback function
@@ -108,9 +728,27 @@ Std_Returntype ADC_SetCallBack(void (*pf_callback)(void)){
 	return ret;
 }
 
+#if (ADC_BINDING_RUNTIME == ADC_BINDING)
 /* ADC_ISR */
 void __vector_16(void) __attribute__((signal));
 void __vector_16(void){
+	uint8 channel;
+	ADC_Handle_t *handle = ADC_Active_Handle;
+	ADC_Conversion_Complete = 1;
+	if(handle){
+		handle->result = ADC_Read_Result();
+		handle->state = ADC_HANDLE_READY;
+		ADC_Active_Handle = NULL;
+	}
+	if(ADC_Window_Monitor_Active){
+		/* Check the finished channel and chain the conversion of the next one */
+		channel = ADC->ADMUX.MUX;
+		if((ADC_Window_Mask >> channel) & 0x01)
+			ADC_Window_Process(channel, ADC_Read_Result());
+		ADC->ADMUX.MUX = ADC_Window_Next_Channel(channel);
+		ADC->ADCSRA.ADSC = 1;
+	}
 	if(ADC_Callback)
 		ADC_Callback();
 }
+#endif
@@ -23,6 +23,12 @@
 #define PORTD_BASE		(0x30)
 #define EXTI_BASE		(0x54)
 #define ADC_BASE		(0x24)
+#define EEPROM_BASE		(0x3C)
+#define AC_BASE			(0x28)
+#define TIMER0_BASE		(0x52)
+#define TIMER1_BASE		(0x46)
+#define TIMER2_BASE		(0x42)
+#define TIMERS_INT_BASE	(0x58)
 
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -52,6 +58,10 @@ typedef union{
 		volatile uint8 ISC10	:1;
 		volatile uint8 ISC11	:1;
 	};
+	struct{
+		volatile uint8 			:4;
+		volatile uint8 SM		:3;
+	};
 }MCUCR_bits;
 
 typedef union{
@@ -165,10 +175,177 @@ typedef struct{
 	ADCLH_bits 	ADCLH;
 	ADCSRA_bits ADCSRA;
 	ADMUX_bits	ADMUX;
-	volatile uint8 reserved[39];
+	volatile uint8 reserved[40];
 	SFIOR_bits	SFIOR;
 }ADC_Typedef;
 
+/* Analog Comparator */
+typedef union{
+	volatile uint8 ACSR_REG;
+	struct{
+		volatile uint8 ACIS		:2;
+		volatile uint8 ACIC		:1;
+		volatile uint8 ACIE		:1;
+		volatile uint8 ACI		:1;
+		volatile uint8 ACO		:1;
+		volatile uint8 ACBG		:1;
+		volatile uint8 ACD		:1;
+	};
+	struct{
+		volatile uint8 ACIS0	:1;
+		volatile uint8 ACIS1	:1;
+	};
+}ACSR_bits;
+
+typedef struct{
+	ACSR_bits	ACSR;
+	volatile uint8 reserved[39];
+	SFIOR_bits	SFIOR;
+}AC_Typedef;
+
+/* EEPROM */
+typedef union{
+	volatile uint8 EECR_REG;
+	struct{
+		volatile uint8 EERE		:1;
+		volatile uint8 EEWE		:1;
+		volatile uint8 EEMWE	:1;
+		volatile uint8 EERIE	:1;
+	};
+}EECR_bits;
+
+typedef struct{
+	EECR_bits		EECR;
+	volatile uint8	EEDR;
+	volatile uint16	EEAR;
+}EEPROM_Typedef;
+
+/* TIMER0 / TIMER2 (same control layout) */
+typedef union{
+	volatile uint8 TCCR_REG;
+	struct{
+		volatile uint8 CS		:3;
+		volatile uint8 WGM1		:1;
+		volatile uint8 COM		:2;
+		volatile uint8 WGM0		:1;
+		volatile uint8 FOC		:1;
+	};
+	struct{
+		volatile uint8 CS0		:1;
+		volatile uint8 CS1		:1;
+		volatile uint8 CS2		:1;
+		volatile uint8 			:1;
+		volatile uint8 COM0		:1;
+		volatile uint8 COM1		:1;
+	};
+}TCCR_8bit_bits;
+
+typedef struct{
+	volatile uint8	TCNT0;
+	TCCR_8bit_bits	TCCR0;
+	volatile uint8	reserved[8];
+	volatile uint8	OCR0;
+}TIMER0_Typedef;
+
+typedef union{
+	volatile uint8 ASSR_REG;
+	struct{
+		volatile uint8 TCR2UB	:1;
+		volatile uint8 OCR2UB	:1;
+		volatile uint8 TCN2UB	:1;
+		volatile uint8 AS2		:1;
+	};
+}ASSR_bits;
+
+typedef struct{
+	ASSR_bits		ASSR;
+	volatile uint8	OCR2;
+	volatile uint8	TCNT2;
+	TCCR_8bit_bits	TCCR2;
+}TIMER2_Typedef;
+
+/* TIMER1 */
+typedef union{
+	volatile uint8 TCCR1A_REG;
+	struct{
+		volatile uint8 WGM1L	:2;
+		volatile uint8 FOC1B	:1;
+		volatile uint8 FOC1A	:1;
+		volatile uint8 COM1B	:2;
+		volatile uint8 COM1A	:2;
+	};
+	struct{
+		volatile uint8 WGM10	:1;
+		volatile uint8 WGM11	:1;
+		volatile uint8 			:2;
+		volatile uint8 COM1B0	:1;
+		volatile uint8 COM1B1	:1;
+		volatile uint8 COM1A0	:1;
+		volatile uint8 COM1A1	:1;
+	};
+}TCCR1A_bits;
+
+typedef union{
+	volatile uint8 TCCR1B_REG;
+	struct{
+		volatile uint8 CS1		:3;
+		volatile uint8 WGM1H	:2;
+		volatile uint8 			:1;
+		volatile uint8 ICES1	:1;
+		volatile uint8 ICNC1	:1;
+	};
+	struct{
+		volatile uint8 CS10		:1;
+		volatile uint8 CS11		:1;
+		volatile uint8 CS12		:1;
+		volatile uint8 WGM12	:1;
+		volatile uint8 WGM13	:1;
+	};
+}TCCR1B_bits;
+
+typedef struct{
+	volatile uint16	ICR1;
+	volatile uint16	OCR1B;
+	volatile uint16	OCR1A;
+	volatile uint16	TCNT1;
+	TCCR1B_bits		TCCR1B;
+	TCCR1A_bits		TCCR1A;
+}TIMER1_Typedef;
+
+/* Timers interrupt flags and masks */
+typedef union{
+	volatile uint8 TIFR_REG;
+	struct{
+		volatile uint8 TOV0		:1;
+		volatile uint8 OCF0		:1;
+		volatile uint8 TOV1		:1;
+		volatile uint8 OCF1B	:1;
+		volatile uint8 OCF1A	:1;
+		volatile uint8 ICF1		:1;
+		volatile uint8 TOV2		:1;
+		volatile uint8 OCF2		:1;
+	};
+}TIFR_bits;
+
+typedef union{
+	volatile uint8 TIMSK_REG;
+	struct{
+		volatile uint8 TOIE0	:1;
+		volatile uint8 OCIE0	:1;
+		volatile uint8 TOIE1	:1;
+		volatile uint8 OCIE1B	:1;
+		volatile uint8 OCIE1A	:1;
+		volatile uint8 TICIE1	:1;
+		volatile uint8 TOIE2	:1;
+		volatile uint8 OCIE2	:1;
+	};
+}TIMSK_bits;
+
+typedef struct{
+	TIFR_bits	TIFR;
+	TIMSK_bits	TIMSK;
+}TIMERS_INT_Typedef;
+
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 // Section: Peripheral instants
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -179,6 +356,12 @@ typedef struct{
 #define GPIOD	((GPIO_Typedef*)PORTD_BASE)
 #define EXTI	((EXTI_Typedef*)EXTI_BASE)
 #define ADC		((ADC_Typedef*) ADC_BASE)
+#define EEPROM	((EEPROM_Typedef*) EEPROM_BASE)
+#define AC		((AC_Typedef*) AC_BASE)
+#define TIMER0	((TIMER0_Typedef*) TIMER0_BASE)
+#define TIMER1	((TIMER1_Typedef*) TIMER1_BASE)
+#define TIMER2	((TIMER2_Typedef*) TIMER2_BASE)
+#define TIMERS_INT	((TIMERS_INT_Typedef*) TIMERS_INT_BASE)
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 // Section: General Macros
@@ -186,4 +369,20 @@ typedef struct{
 #define GLOBAL_INTERRUPT_ENABLE()	(SREG |= (1U<<7))
 #define GLOBAL_INTERRUPT_DISABLE()	(SREG &= ~(1U<<7))
 
+/* Sleep instruction, the "sei; sleep" pair guarantees that an interrupt pending
+ * at the time of enabling is served only after the CPU has entered sleep */
+#define CPU_SLEEP()					__asm__ __volatile__("sleep")
+#define CPU_ENABLE_INTERRUPT_AND_SLEEP()	__asm__ __volatile__("sei" "\n\t" "sleep")
+
+/* One cycle delay, e.g. for the input synchronizer between a PORT write and a PIN read */
+#define CPU_NOP()					__asm__ __volatile__("nop")
+
+// @ref SLEEP_MODE_define (MCUCR.SM)
+#define SLEEP_MODE_IDLE					(0)
+#define SLEEP_MODE_ADC_NOISE_REDUCTION	(1)
+#define SLEEP_MODE_POWER_DOWN			(2)
+#define SLEEP_MODE_POWER_SAVE			(3)
+#define SLEEP_MODE_STANDBY				(6)
+#define SLEEP_MODE_EXTENDED_STANDBY		(7)
+
 #endif /* MCAL_ATMEGA32_H_ */
@@ -0,0 +1,70 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : EEPROM_interface.h                           		 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef MCAL_EEPROM_EEPROM_INTERFACE_H_
+#define MCAL_EEPROM_EEPROM_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../ATMEGA32.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define EEPROM_SIZE		1024U
+
+/*
+ * =============================================
+ * APIs Supported by "EEPROM"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- EEPROM_Read_Byte
+ * @brief 		- Reads one byte from the EEPROM
+ * @param [in] 	- address: EEPROM address (0 -> EEPROM_SIZE-1)
+ * @param [out] - data: pointer to the variable that will return the read byte
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Waits for any ongoing write to finish
+ */
+Std_Returntype EEPROM_Read_Byte(uint16 address, uint8 *data);
+
+/**=============================================
+ * @Fn			- EEPROM_Write_Byte
+ * @brief 		- Writes one byte to the EEPROM
+ * @param [in] 	- address: EEPROM address (0 -> EEPROM_SIZE-1)
+ * @param [in] 	- data: byte to be written
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Interrupts are disabled for the timed EEMWE/EEWE sequence only
+ */
+Std_Returntype EEPROM_Write_Byte(uint16 address, uint8 data);
+
+/**=============================================
+ * @Fn			- EEPROM_Read_Block
+ * @brief 		- Reads a block of bytes from the EEPROM
+ * @param [in] 	- address: EEPROM address of the first byte
+ * @param [out] - data: pointer to the buffer that will hold the block
+ * @param [in] 	- length: number of bytes to be read
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EEPROM_Read_Block(uint16 address, uint8 *data, uint16 length);
+
+/**=============================================
+ * @Fn			- EEPROM_Write_Block
+ * @brief 		- Writes a block of bytes to the EEPROM
+ * @param [in] 	- address: EEPROM address of the first byte
+ * @param [in] 	- data: pointer to the block to be written
+ * @param [in] 	- length: number of bytes to be written
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Bytes that already hold the same value are not rewritten
+ */
+Std_Returntype EEPROM_Write_Block(uint16 address, const uint8 *data, uint16 length);
+
+#endif /* MCAL_EEPROM_EEPROM_INTERFACE_H_ */
@@ -0,0 +1,108 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : EEPROM_program.c                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "EEPROM_interface.h"
+
+#define EEPROM_EECR_EEWE	(0x02)
+#define EEPROM_EECR_EEMWE	(0x04)
+
+/**=============================================
+ * @Fn			- EEPROM_Read_Byte
+ * @brief 		- Reads one byte from the EEPROM
+ * @param [in] 	- address: EEPROM address (0 -> EEPROM_SIZE-1)
+ * @param [out] - data: pointer to the variable that will return the read byte
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Waits for any ongoing write to finish
+ */
+Std_Returntype EEPROM_Read_Byte(uint16 address, uint8 *data){
+	Std_Returntype ret = RET_OK;
+	if((NULL == data) || (EEPROM_SIZE <= address))
+		ret = RET_NOT_OK;
+	else{
+		while(EEPROM->EECR.EEWE); // wait for previous write
+		EEPROM->EEAR = address;
+		EEPROM->EECR.EERE = 1;
+		*data = EEPROM->EEDR;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EEPROM_Write_Byte
+ * @brief 		- Writes one byte to the EEPROM
+ * @param [in] 	- address: EEPROM address (0 -> EEPROM_SIZE-1)
+ * @param [in] 	- data: byte to be written
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Interrupts are disabled for the timed EEMWE/EEWE sequence only
+ */
+Std_Returntype EEPROM_Write_Byte(uint16 address, uint8 data){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if(EEPROM_SIZE <= address)
+		ret = RET_NOT_OK;
+	else{
+		while(EEPROM->EECR.EEWE); // wait for previous write
+		EEPROM->EEAR = address;
+		EEPROM->EEDR = data;
+
+		/* EEWE must be set within four cycles after EEMWE */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		EEPROM->EECR.EECR_REG = EEPROM_EECR_EEMWE;
+		EEPROM->EECR.EECR_REG = (EEPROM_EECR_EEMWE | EEPROM_EECR_EEWE);
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EEPROM_Read_Block
+ * @brief 		- Reads a block of bytes from the EEPROM
+ * @param [in] 	- address: EEPROM address of the first byte
+ * @param [out] - data: pointer to the buffer that will hold the block
+ * @param [in] 	- length: number of bytes to be read
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EEPROM_Read_Block(uint16 address, uint8 *data, uint16 length){
+	Std_Returntype ret = RET_OK;
+	uint16 index;
+	if((NULL == data) || (EEPROM_SIZE < length) || ((EEPROM_SIZE - length) < address))
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < length; index++)
+			ret |= EEPROM_Read_Byte(address + index, &data[index]);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EEPROM_Write_Block
+ * @brief 		- Writes a block of bytes to the EEPROM
+ * @param [in] 	- address: EEPROM address of the first byte
+ * @param [in] 	- data: pointer to the block to be written
+ * @param [in] 	- length: number of bytes to be written
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Bytes that already hold the same value are not rewritten
+ */
+Std_Returntype EEPROM_Write_Block(uint16 address, const uint8 *data, uint16 length){
+	Std_Returntype ret = RET_OK;
+	uint16 index;
+	uint8 current;
+	if((NULL == data) || (EEPROM_SIZE < length) || ((EEPROM_SIZE - length) < address))
+		ret = RET_NOT_OK;
+	else{
+		for(index = 0; index < length; index++){
+			ret |= EEPROM_Read_Byte(address + index, &current);
+			if(current != data[index])
+				ret |= EEPROM_Write_Byte(address + index, data[index]);
+		}
+	}
+	return ret;
+}
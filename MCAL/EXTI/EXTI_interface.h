@@ -13,6 +13,7 @@
 // Section: Includes
 //----------------------------------------------
 #include "../ATMEGA32.h"
+#include "../TIMER/TIMER_interface.h"
 
 //----------------------------------------------
 // Section: User type definitions
@@ -21,8 +22,15 @@ typedef struct{
 	uint8 number; 	// @ref EXTI_define
 	uint8 mode;		// @ref EXTI_TRIGGER_define
 	void (*pf_CallBack)(void);
+	uint8 dispatch;	// @ref EXTI_DISPATCH_define
 }EXTI_cfg;
 
+typedef struct{
+	uint32	timestamp;	// Timer1 ticks extended by the overflow count
+	uint8	number;		// @ref EXTI_define
+	uint8	level;		// pin level sampled in the ISR (0/1)
+}EXTI_Event_t;
+
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
@@ -38,6 +46,55 @@ typedef struct{
 #define EXTI_TRIGGER_FALLING_EDGE		2
 #define EXTI_TRIGGER_RISING_EDGE		3
 
+// @ref EXTI_DISPATCH_define
+#define EXTI_DISPATCH_CALLBACK			0	/* ISR calls pf_CallBack */
+#define EXTI_DISPATCH_QUEUE				1	/* ISR only pushes a timestamped EXTI_Event_t */
+
+// @ref EXTI_TIMESTAMP_PRESCALE_define (Timer1 prescaler of the TIMER timebase)
+#define EXTI_TIMESTAMP_PRESCALE_1		TIMER_PRESCALE_1
+#define EXTI_TIMESTAMP_PRESCALE_8		TIMER_PRESCALE_8
+#define EXTI_TIMESTAMP_PRESCALE_64		TIMER_PRESCALE_64
+#define EXTI_TIMESTAMP_PRESCALE_256		TIMER_PRESCALE_256
+#define EXTI_TIMESTAMP_PRESCALE_1024	TIMER_PRESCALE_1024
+
+/* Number of queued events, must be a power of 2 */
+#define EXTI_QUEUE_SIZE					16U
+
+/* Subscribers of each line, at most 8 (one bit of the enable mask each) */
+#define EXTI_SUBSCRIBERS_PER_LINE		4U
+
+// @ref EXTI_PRIORITY_define (lower value is called first, equal priorities in subscription order)
+#define EXTI_PRIORITY_HIGHEST			0
+#define EXTI_PRIORITY_NORMAL			128
+#define EXTI_PRIORITY_LOWEST			255
+
+// @ref EXTI_BINDING_define
+#define EXTI_BINDING_RUNTIME			0	/* driver defines the vector, callback set at runtime */
+#define EXTI_BINDING_STATIC				1	/* application defines the vector with EXTI_BIND_ISR */
+
+/* Binding of each line, override with -D for every translation unit (e.g. -DEXTI_INT0_BINDING=1) */
+#ifndef EXTI_INT0_BINDING
+#define EXTI_INT0_BINDING				EXTI_BINDING_RUNTIME
+#endif
+#ifndef EXTI_INT1_BINDING
+#define EXTI_INT1_BINDING				EXTI_BINDING_RUNTIME
+#endif
+#ifndef EXTI_INT2_BINDING
+#define EXTI_INT2_BINDING				EXTI_BINDING_RUNTIME
+#endif
+
+// @ref EXTI_VECTOR_define
+#define EXTI_INT0_VECTOR				__vector_1
+#define EXTI_INT1_VECTOR				__vector_2
+#define EXTI_INT2_VECTOR				__vector_3
+
+/* Defines the vector of a statically bound line @ref EXTI_VECTOR_define. The handler is called
+ * directly, so a static inline handler in the same file is inlined into the vector and only
+ * the registers it uses are saved. Callbacks and queue mode do not apply to that line */
+#define EXTI_BIND_ISR(vector, handler)						\
+	void vector(void) __attribute__((signal));				\
+	void vector(void){ handler(); }
+
 /*
  * =============================================
  * APIs Supported by "EXTI"
@@ -62,6 +119,16 @@ Std_Returntype EXTI_Init(const EXTI_cfg* cfg);
  */
 Std_Returntype EXTI_DeInit(uint8 number);
 
+/**=============================================
+ * @Fn			- EXTI_Enable
+ * @brief 		- Re-enables an EXTI stopped by EXTI_DeInit, keeping its trigger and callbacks
+ * @param [in] 	- number: number of INT pin to be enabled (INT0-INT2) @ref EXTI_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Clears a request latched while the line was disabled. Does not change the
+ * 				  global interrupt, so it can be called from an ISR
+ */
+Std_Returntype EXTI_Enable(uint8 number);
+
 /**=============================================
  * @Fn			- EXTI_SetCallBack
  * @brief 		- Sets the callback function of a specific EXTI
@@ -72,5 +139,75 @@ Std_Returntype EXTI_DeInit(uint8 number);
  */
 Std_Returntype EXTI_SetCallBack(uint8 number, void (*pf_callback)(void));
 
+/**=============================================
+ * @Fn			- EXTI_Subscribe
+ * @brief 		- Adds a callback to the subscriber table of a specific EXTI
+ * @param [in] 	- number: number of INT pin (INT0-INT2) @ref EXTI_define
+ * @param [in] 	- pf_callback: pointer to the function to be called from the ISR
+ * @param [in] 	- priority: call order among the line subscribers @ref EXTI_PRIORITY_define
+ * @param [out] - handle: pointer to the variable that will return the subscriber handle
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or the table of the line is full
+ * Note			- The subscriber is enabled, the callback set by EXTI_Init/EXTI_SetCallBack runs first
+ */
+Std_Returntype EXTI_Subscribe(uint8 number, void (*pf_callback)(void), uint8 priority, uint8 *handle);
+
+/**=============================================
+ * @Fn			- EXTI_Unsubscribe
+ * @brief 		- Removes a subscriber from the table of a specific EXTI
+ * @param [in] 	- number: number of INT pin (INT0-INT2) @ref EXTI_define
+ * @param [in] 	- handle: handle returned by EXTI_Subscribe
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EXTI_Unsubscribe(uint8 number, uint8 handle);
+
+/**=============================================
+ * @Fn			- EXTI_Subscriber_Enable
+ * @brief 		- Enables or disables a subscriber without removing it
+ * @param [in] 	- number: number of INT pin (INT0-INT2) @ref EXTI_define
+ * @param [in] 	- handle: handle returned by EXTI_Subscribe
+ * @param [in] 	- enable: 1 to call the subscriber from the ISR, 0 to skip it
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EXTI_Subscriber_Enable(uint8 number, uint8 handle, uint8 enable);
+
+/**=============================================
+ * @Fn			- EXTI_Timestamp_Init
+ * @brief 		- Starts Timer1 free running as the timebase of the EXTI events
+ * @param [in] 	- prescaler: Timer1 clock prescaler @ref EXTI_TIMESTAMP_PRESCALE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Same as TIMER_Timebase_Init, Timer1 is owned by the timebase afterwards
+ */
+Std_Returntype EXTI_Timestamp_Init(uint8 prescaler);
+
+/**=============================================
+ * @Fn			- EXTI_Get_Timestamp
+ * @brief 		- Returns the current value of the EXTI timebase
+ * @param [out] - timestamp: pointer to the variable that will return the timestamp in Timer1 ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EXTI_Get_Timestamp(uint32 *timestamp);
+
+/**=============================================
+ * @Fn			- EXTI_Get_Event
+ * @brief 		- Returns the oldest queued EXTI event without blocking
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if the queue is empty
+ * Note			- Only lines configured with EXTI_DISPATCH_QUEUE post events
+ */
+Std_Returntype EXTI_Get_Event(EXTI_Event_t *event);
+
+/**=============================================
+ * @Fn			- EXTI_Get_Dropped_Count
+ * @brief 		- Returns the number of events lost because the queue was full
+ * @param [out] - count: pointer to the variable that will return the count
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The count saturates at 255
+ */
+Std_Returntype EXTI_Get_Dropped_Count(uint8 *count);
+
 
 #endif /* MCAL_EXTI_EXTI_INTERFACE_H_ */
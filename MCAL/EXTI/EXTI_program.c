@@ -8,9 +8,73 @@
 /*************************************************************************/
 
 #include "EXTI_interface.h"
+#include "../../SERVICES/BIT_MATH.h"
+
+/* Pin of each line, used to sample the level in queue mode */
+#define EXTI_INT0_PIN	2	/* PD2 */
+#define EXTI_INT1_PIN	3	/* PD3 */
+#define EXTI_INT2_PIN	2	/* PB2 */
+
+#define EXTI_LINE_INVALID	0xFF
 
 static void (*EXTI_Callback_Functions[3])(void);
 
+/* Subscribers are stored by handle, EXTI_Subscriber_Order keeps the handles sorted by priority */
+static void (*EXTI_Subscriber_Functions[3][EXTI_SUBSCRIBERS_PER_LINE])(void);
+static uint8 EXTI_Subscriber_Priority[3][EXTI_SUBSCRIBERS_PER_LINE];
+static uint8 EXTI_Subscriber_Order[3][EXTI_SUBSCRIBERS_PER_LINE];
+static uint8 EXTI_Subscriber_Count[3];
+static uint8 EXTI_Subscriber_Mask[3];
+
+static uint8 EXTI_Dispatch[3];
+
+static EXTI_Event_t EXTI_Queue[EXTI_QUEUE_SIZE];
+static volatile uint8 EXTI_Queue_Head;
+static volatile uint8 EXTI_Queue_Tail;
+static volatile uint8 EXTI_Dropped_Count;
+
+static uint8 EXTI_Line_Index(uint8 number){
+	uint8 line;
+	if(EXTI_INT0 == number)
+		line = 0;
+	else if(EXTI_INT1 == number)
+		line = 1;
+	else if(EXTI_INT2 == number)
+		line = 2;
+	else
+		line = EXTI_LINE_INVALID;
+	return line;
+}
+
+/* Called from the ISRs, the loop is bounded by EXTI_SUBSCRIBERS_PER_LINE */
+static inline void EXTI_Notify(uint8 line){
+	uint8 index, handle;
+	uint8 count = EXTI_Subscriber_Count[line];
+	uint8 mask = EXTI_Subscriber_Mask[line];
+	if(EXTI_Callback_Functions[line])
+		EXTI_Callback_Functions[line]();
+	for(index = 0; index < count; index++){
+		handle = EXTI_Subscriber_Order[line][index];
+		if(GET_BIT(mask, handle))
+			EXTI_Subscriber_Functions[line][handle]();
+	}
+}
+
+/* Called from the ISRs only, AVR ISRs do not nest so there is a single producer */
+static inline void EXTI_Queue_Push(uint8 number, uint8 level){
+	uint32 timestamp = TIMER_Read_Timebase();
+	uint8 head = EXTI_Queue_Head;
+	uint8 next_head = (head + 1) & (EXTI_QUEUE_SIZE - 1);
+	if(next_head != EXTI_Queue_Tail){
+		EXTI_Queue[head].timestamp = timestamp;
+		EXTI_Queue[head].number = number;
+		EXTI_Queue[head].level = level;
+		EXTI_Queue_Head = next_head;
+	}
+	else if(0xFF != EXTI_Dropped_Count)
+		EXTI_Dropped_Count++;
+}
+
 /**=============================================
  * @Fn			- EXTI_Init
  * @brief 		- Initializes EXTI (INT0-INT2) and enables global interrupt
@@ -34,6 +98,7 @@ Std_Returntype EXTI_Init(const EXTI_cfg* cfg){
 			/* Set the callback function */
 			if(cfg->pf_CallBack)
 				EXTI_Callback_Functions[0] = cfg->pf_CallBack;
+			EXTI_Dispatch[0] = cfg->dispatch;
 
 			/* Enable INT0 */
 			EXTI->GICR.INT0 = 1;
@@ -51,6 +116,7 @@ Std_Returntype EXTI_Init(const EXTI_cfg* cfg){
 			/* Set the callback function */
 			if(cfg->pf_CallBack)
 				EXTI_Callback_Functions[1] = cfg->pf_CallBack;
+			EXTI_Dispatch[1] = cfg->dispatch;
 
 			/* Enable INT1 */
 			EXTI->GICR.INT1 = 1;
@@ -73,6 +139,7 @@ Std_Returntype EXTI_Init(const EXTI_cfg* cfg){
 			/* Set the callback function */
 			if(cfg->pf_CallBack)
 				EXTI_Callback_Functions[2] = cfg->pf_CallBack;
+			EXTI_Dispatch[2] = cfg->dispatch;
 
 			/* Enable INT0 */
 			EXTI->GICR.INT2 = 1;
@@ -96,16 +163,40 @@ Std_Returntype EXTI_Init(const EXTI_cfg* cfg){
 Std_Returntype EXTI_DeInit(uint8 number){
 	Std_Returntype ret = RET_OK;
 	if(EXTI_INT0 == number)
-		EXTI->GICR.INT0;
+		EXTI->GICR.INT0 = 0;
 	else if(EXTI_INT1 == number)
-		EXTI->GICR.INT1;
+		EXTI->GICR.INT1 = 0;
 	else if(EXTI_INT2 == number)
-		EXTI->GICR.INT2;
+		EXTI->GICR.INT2 = 0;
 	else
 		ret |= RET_NOT_OK;
 	return ret;
 }
 
+/**=============================================
+ * @Fn			- EXTI_Enable
+ * @brief 		- Re-enables an EXTI stopped by EXTI_DeInit, keeping its trigger and callbacks
+ * @param [in] 	- number: number of INT pin to be enabled (INT0-INT2) @ref EXTI_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Clears a request latched while the line was disabled. Does not change the
+ * 				  global interrupt, so it can be called from an ISR
+ */
+Std_Returntype EXTI_Enable(uint8 number){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if(EXTI_LINE_INVALID == EXTI_Line_Index(number))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		/* INTFn and INTn share the bit number of the line, the flag is cleared by writing 1 */
+		EXTI->GIFR.GIFR_REG = (1U << number);
+		EXTI->GICR.GICR_REG |= (1U << number);
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
 /**=============================================
  * @Fn			- EXTI_SetCallBack
  * @brief 		- Sets the callback function of a specific EXTI
@@ -131,23 +222,192 @@ Std_Returntype EXTI_SetCallBack(uint8 number, void (*pf_callback)(void)){
 	return ret;
 }
 
+/**=============================================
+ * @Fn			- EXTI_Subscribe
+ * @brief 		- Adds a callback to the subscriber table of a specific EXTI
+ * @param [in] 	- number: number of INT pin (INT0-INT2) @ref EXTI_define
+ * @param [in] 	- pf_callback: pointer to the function to be called from the ISR
+ * @param [in] 	- priority: call order among the line subscribers @ref EXTI_PRIORITY_define
+ * @param [out] - handle: pointer to the variable that will return the subscriber handle
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * 				  or the table of the line is full
+ * Note			- The subscriber is enabled, the callback set by EXTI_Init/EXTI_SetCallBack runs first
+ */
+Std_Returntype EXTI_Subscribe(uint8 number, void (*pf_callback)(void), uint8 priority, uint8 *handle){
+	Std_Returntype ret = RET_OK;
+	uint8 line = EXTI_Line_Index(number);
+	uint8 slot, position, count, sreg_state;
+	if((NULL == pf_callback) || (NULL == handle) || (EXTI_LINE_INVALID == line))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		count = EXTI_Subscriber_Count[line];
+		/* Free slot is the first one without a function */
+		for(slot = 0; (slot < EXTI_SUBSCRIBERS_PER_LINE) && (EXTI_Subscriber_Functions[line][slot]); slot++);
+		if(EXTI_SUBSCRIBERS_PER_LINE == slot)
+			ret = RET_NOT_OK;
+		else{
+			EXTI_Subscriber_Functions[line][slot] = pf_callback;
+			EXTI_Subscriber_Priority[line][slot] = priority;
+			/* Insert after every subscriber of the same or a higher priority */
+			for(position = count; (position > 0) &&
+					(EXTI_Subscriber_Priority[line][EXTI_Subscriber_Order[line][position - 1]] > priority); position--)
+				EXTI_Subscriber_Order[line][position] = EXTI_Subscriber_Order[line][position - 1];
+			EXTI_Subscriber_Order[line][position] = slot;
+			EXTI_Subscriber_Count[line] = count + 1;
+			SET_BIT(EXTI_Subscriber_Mask[line], slot);
+			*handle = slot;
+		}
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EXTI_Unsubscribe
+ * @brief 		- Removes a subscriber from the table of a specific EXTI
+ * @param [in] 	- number: number of INT pin (INT0-INT2) @ref EXTI_define
+ * @param [in] 	- handle: handle returned by EXTI_Subscribe
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EXTI_Unsubscribe(uint8 number, uint8 handle){
+	Std_Returntype ret = RET_OK;
+	uint8 line = EXTI_Line_Index(number);
+	uint8 position, count, sreg_state;
+	if((EXTI_LINE_INVALID == line) || (EXTI_SUBSCRIBERS_PER_LINE <= handle) ||
+			(NULL == EXTI_Subscriber_Functions[line][handle]))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		count = EXTI_Subscriber_Count[line];
+		for(position = 0; EXTI_Subscriber_Order[line][position] != handle; position++);
+		for(; position < (count - 1); position++)
+			EXTI_Subscriber_Order[line][position] = EXTI_Subscriber_Order[line][position + 1];
+		EXTI_Subscriber_Count[line] = count - 1;
+		CLR_BIT(EXTI_Subscriber_Mask[line], handle);
+		EXTI_Subscriber_Functions[line][handle] = NULL;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EXTI_Subscriber_Enable
+ * @brief 		- Enables or disables a subscriber without removing it
+ * @param [in] 	- number: number of INT pin (INT0-INT2) @ref EXTI_define
+ * @param [in] 	- handle: handle returned by EXTI_Subscribe
+ * @param [in] 	- enable: 1 to call the subscriber from the ISR, 0 to skip it
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EXTI_Subscriber_Enable(uint8 number, uint8 handle, uint8 enable){
+	Std_Returntype ret = RET_OK;
+	uint8 line = EXTI_Line_Index(number);
+	uint8 sreg_state;
+	if((EXTI_LINE_INVALID == line) || (EXTI_SUBSCRIBERS_PER_LINE <= handle) ||
+			(NULL == EXTI_Subscriber_Functions[line][handle]))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		if(enable)
+			SET_BIT(EXTI_Subscriber_Mask[line], handle);
+		else
+			CLR_BIT(EXTI_Subscriber_Mask[line], handle);
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EXTI_Timestamp_Init
+ * @brief 		- Starts Timer1 free running as the timebase of the EXTI events
+ * @param [in] 	- prescaler: Timer1 clock prescaler @ref EXTI_TIMESTAMP_PRESCALE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Same as TIMER_Timebase_Init, Timer1 is owned by the timebase afterwards
+ */
+Std_Returntype EXTI_Timestamp_Init(uint8 prescaler){
+	return TIMER_Timebase_Init(prescaler);
+}
+
+/**=============================================
+ * @Fn			- EXTI_Get_Timestamp
+ * @brief 		- Returns the current value of the EXTI timebase
+ * @param [out] - timestamp: pointer to the variable that will return the timestamp in Timer1 ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype EXTI_Get_Timestamp(uint32 *timestamp){
+	return TIMER_Get_Timebase(timestamp);
+}
+
+/**=============================================
+ * @Fn			- EXTI_Get_Event
+ * @brief 		- Returns the oldest queued EXTI event without blocking
+ * @param [out] - event: pointer to the variable that will return the event
+ * @retval 		- return RET_OK if an event was returned, and returns RET_NOT_OK if the queue is empty
+ * Note			- Only lines configured with EXTI_DISPATCH_QUEUE post events
+ */
+Std_Returntype EXTI_Get_Event(EXTI_Event_t *event){
+	Std_Returntype ret = RET_OK;
+	uint8 tail = EXTI_Queue_Tail;
+	if((NULL == event) || (tail == EXTI_Queue_Head))
+		ret = RET_NOT_OK;
+	else{
+		*event = EXTI_Queue[tail];
+		EXTI_Queue_Tail = (tail + 1) & (EXTI_QUEUE_SIZE - 1);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- EXTI_Get_Dropped_Count
+ * @brief 		- Returns the number of events lost because the queue was full
+ * @param [out] - count: pointer to the variable that will return the count
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The count saturates at 255
+ */
+Std_Returntype EXTI_Get_Dropped_Count(uint8 *count){
+	Std_Returntype ret = RET_OK;
+	if(NULL == count)
+		ret = RET_NOT_OK;
+	else
+		*count = EXTI_Dropped_Count;
+	return ret;
+}
+
+#if (EXTI_BINDING_RUNTIME == EXTI_INT0_BINDING)
 /* INT0_ISR */
 void __vector_1(void) __attribute__((signal));
 void __vector_1(void){
-	if(EXTI_Callback_Functions[0])
-		EXTI_Callback_Functions[0]();
+	if(EXTI_DISPATCH_QUEUE == EXTI_Dispatch[0])
+		EXTI_Queue_Push(EXTI_INT0, GET_BIT(GPIOD->PIN, EXTI_INT0_PIN));
+	else
+		EXTI_Notify(0);
 }
+#endif
 
+#if (EXTI_BINDING_RUNTIME == EXTI_INT1_BINDING)
 /* INT1_ISR */
 void __vector_2(void) __attribute__((signal));
 void __vector_2(void){
-	if(EXTI_Callback_Functions[1])
-		EXTI_Callback_Functions[1]();
+	if(EXTI_DISPATCH_QUEUE == EXTI_Dispatch[1])
+		EXTI_Queue_Push(EXTI_INT1, GET_BIT(GPIOD->PIN, EXTI_INT1_PIN));
+	else
+		EXTI_Notify(1);
 }
+#endif
 
+#if (EXTI_BINDING_RUNTIME == EXTI_INT2_BINDING)
 /* INT2_ISR */
 void __vector_3(void) __attribute__((signal));
 void __vector_3(void){
-	if(EXTI_Callback_Functions[2])
-		EXTI_Callback_Functions[2]();
+	if(EXTI_DISPATCH_QUEUE == EXTI_Dispatch[2])
+		EXTI_Queue_Push(EXTI_INT2, GET_BIT(GPIOB->PIN, EXTI_INT2_PIN));
+	else
+		EXTI_Notify(2);
 }
+#endif
@@ -0,0 +1,294 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : TIMER_interface.h                           			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef MCAL_TIMER_TIMER_INTERFACE_H_
+#define MCAL_TIMER_TIMER_INTERFACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "../ATMEGA32.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint8	timer;			// @ref TIMER_NUMBER_define
+	uint8	mode;			// @ref TIMER_MODE_define
+	uint8	prescaler;		// @ref TIMER_PRESCALE_define, TIMER_PRESCALE_STOP leaves the timer stopped
+	uint16	period;			// TOP in CTC mode (OCR0, OCR1A, OCR2) and in Timer1 PWM modes (ICR1),
+							// Timer0/Timer2 PWM always count to 0xFF
+	uint16	compare_a;		// OCR0, OCR1A, OCR2: duty in PWM modes, match value in normal mode
+	uint16	compare_b;		// OCR1B, Timer1 only
+	uint8	output_a;		// OC0 (PB3), OC1A (PD5), OC2 (PD7) @ref TIMER_OUTPUT_define
+	uint8	output_b;		// OC1B (PD4), Timer1 only @ref TIMER_OUTPUT_define
+}TIMER_cfg;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref TIMER_NUMBER_define
+#define TIMER_0							0
+#define TIMER_1							1
+#define TIMER_2							2
+
+// @ref TIMER_MODE_define
+#define TIMER_MODE_NORMAL				0	/* counts to the maximum and overflows */
+#define TIMER_MODE_CTC					1	/* clears on period, compare A interrupt each period */
+#define TIMER_MODE_FAST_PWM				2
+#define TIMER_MODE_PHASE_CORRECT_PWM	3	/* counts up then down, half the frequency of fast PWM */
+
+// @ref TIMER_PRESCALE_define
+/* Timer0/Timer1 do not have 32 and 128, Timer2 does not have the external clock (T0 = PB0, T1 = PB1) */
+#define TIMER_PRESCALE_STOP				0
+#define TIMER_PRESCALE_1				1
+#define TIMER_PRESCALE_8				2
+#define TIMER_PRESCALE_32				3
+#define TIMER_PRESCALE_64				4
+#define TIMER_PRESCALE_128				5
+#define TIMER_PRESCALE_256				6
+#define TIMER_PRESCALE_1024				7
+#define TIMER_PRESCALE_EXT_FALLING		8
+#define TIMER_PRESCALE_EXT_RISING		9
+
+// @ref TIMER_OUTPUT_define
+#define TIMER_OUTPUT_DISCONNECTED		0
+#define TIMER_OUTPUT_TOGGLE				1	/* normal and CTC modes only */
+#define TIMER_OUTPUT_CLEAR				2	/* clear on match, non-inverting PWM */
+#define TIMER_OUTPUT_SET				3	/* set on match, inverting PWM */
+#define TIMER_OUTPUT_NON_INVERTING		TIMER_OUTPUT_CLEAR
+#define TIMER_OUTPUT_INVERTING			TIMER_OUTPUT_SET
+
+// @ref TIMER_CHANNEL_define
+#define TIMER_CHANNEL_A					0	/* OCR0, OCR1A, OCR2 */
+#define TIMER_CHANNEL_B					1	/* OCR1B */
+
+// @ref TIMER_INTERRUPT_define
+#define TIMER_INTERRUPT_OVERFLOW		0
+#define TIMER_INTERRUPT_COMPARE_A		1	/* OCF0, OCF1A, OCF2 */
+#define TIMER_INTERRUPT_COMPARE_B		2	/* Timer1 only */
+#define TIMER_INTERRUPT_CAPTURE			3	/* Timer1 only */
+#define TIMER_INTERRUPT_SOURCES			4
+
+// @ref TIMER_CAPTURE_EDGE_define
+#define TIMER_CAPTURE_FALLING			0
+#define TIMER_CAPTURE_RISING			1
+
+// @ref TIMER_NOISE_CANCELER_define
+#define TIMER_NOISE_CANCELER_OFF		0
+#define TIMER_NOISE_CANCELER_ON			1	/* 4 equal samples, delays the capture by 4 timer clocks */
+
+// @ref TIMER_BINDING_define
+#define TIMER_BINDING_RUNTIME			0	/* driver defines the vectors, callbacks set at runtime */
+#define TIMER_BINDING_STATIC			1	/* application defines the vectors with TIMER_BIND_ISR */
+
+/* Binding of each timer, override with -D for every translation unit (e.g. -DTIMER0_BINDING=1).
+ * A static Timer1 binding also removes the timebase */
+#ifndef TIMER0_BINDING
+#define TIMER0_BINDING					TIMER_BINDING_RUNTIME
+#endif
+#ifndef TIMER1_BINDING
+#define TIMER1_BINDING					TIMER_BINDING_RUNTIME
+#endif
+#ifndef TIMER2_BINDING
+#define TIMER2_BINDING					TIMER_BINDING_RUNTIME
+#endif
+
+// @ref TIMER_VECTOR_define
+#define TIMER2_COMP_VECTOR				__vector_4
+#define TIMER2_OVF_VECTOR				__vector_5
+#define TIMER1_CAPT_VECTOR				__vector_6
+#define TIMER1_COMPA_VECTOR				__vector_7
+#define TIMER1_COMPB_VECTOR				__vector_8
+#define TIMER1_OVF_VECTOR				__vector_9
+#define TIMER0_COMP_VECTOR				__vector_10
+#define TIMER0_OVF_VECTOR				__vector_11
+
+/* Defines a vector of a statically bound timer @ref TIMER_VECTOR_define. A static inline
+ * handler in the same file is inlined into the vector, callbacks do not apply to that timer */
+#define TIMER_BIND_ISR(vector, handler)						\
+	void vector(void) __attribute__((signal));				\
+	void vector(void){ handler(); }
+
+/* Timebase overflow count, owned by the TIMER driver (used by TIMER_Read_Timebase) */
+extern volatile uint16 TIMER_Timebase_High;
+
+/*
+ * =============================================
+ * APIs Supported by "TIMER"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- TIMER_Init
+ * @brief 		- Configures the mode, compare values and outputs of a timer, then starts it
+ * @param [in] 	- _TIMER: Pointer to the timer configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Connected output pins are set as outputs. Interrupts are not changed,
+ * 				  Timer1 must not be used while it runs the timebase
+ */
+Std_Returntype TIMER_Init(const TIMER_cfg *_TIMER);
+
+/**=============================================
+ * @Fn			- TIMER_Start
+ * @brief 		- Starts a timer or changes its clock
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- prescaler: @ref TIMER_PRESCALE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 is rejected while it runs the timebase
+ */
+Std_Returntype TIMER_Start(uint8 timer, uint8 prescaler);
+
+/**=============================================
+ * @Fn			- TIMER_Stop
+ * @brief 		- Stops the clock of a timer, the counter keeps its value
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 is rejected while it runs the timebase
+ */
+Std_Returntype TIMER_Stop(uint8 timer);
+
+/**=============================================
+ * @Fn			- TIMER_Set_Counter
+ * @brief 		- Writes the counter of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- value: counter value, at most 0xFF for Timer0/Timer2
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Writing the counter blocks the compare match of the next timer clock.
+ * 				  Timer1 is rejected while it runs the timebase
+ */
+Std_Returntype TIMER_Set_Counter(uint8 timer, uint16 value);
+
+/**=============================================
+ * @Fn			- TIMER_Get_Counter
+ * @brief 		- Reads the counter of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [out] - value: pointer to the variable that will return the counter
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Get_Counter(uint8 timer, uint16 *value);
+
+/**=============================================
+ * @Fn			- TIMER_Set_Compare
+ * @brief 		- Writes a compare register (PWM duty or match value)
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- channel: @ref TIMER_CHANNEL_define
+ * @param [in] 	- value: compare value, at most the period (0xFF for Timer0/Timer2)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- In PWM modes the new value takes effect at the next TOP or BOTTOM (double buffered)
+ */
+Std_Returntype TIMER_Set_Compare(uint8 timer, uint8 channel, uint16 value);
+
+/**=============================================
+ * @Fn			- TIMER_Set_Period
+ * @brief 		- Writes the TOP of a timer in CTC mode or Timer1 PWM modes
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- period: TOP value, the timer counts period + 1 clocks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- In CTC mode a period below the counter lets it run to the maximum once
+ */
+Std_Returntype TIMER_Set_Period(uint8 timer, uint16 period);
+
+/**=============================================
+ * @Fn			- TIMER_Set_Callback
+ * @brief 		- Sets the function called by an interrupt of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- source: @ref TIMER_INTERRUPT_define
+ * @param [in] 	- pf_callback: function called from the ISR, NULL to remove it
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The Timer1 overflow callback still runs when the timebase is used
+ */
+Std_Returntype TIMER_Set_Callback(uint8 timer, uint8 source, void (*pf_callback)(void));
+
+/**=============================================
+ * @Fn			- TIMER_Interrupt_Enable
+ * @brief 		- Clears the pending flag and enables an interrupt of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- source: @ref TIMER_INTERRUPT_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Global interrupts are enabled
+ */
+Std_Returntype TIMER_Interrupt_Enable(uint8 timer, uint8 source);
+
+/**=============================================
+ * @Fn			- TIMER_Interrupt_Disable
+ * @brief 		- Disables an interrupt of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- source: @ref TIMER_INTERRUPT_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Interrupt_Disable(uint8 timer, uint8 source);
+
+/**=============================================
+ * @Fn			- TIMER_Capture_Init
+ * @brief 		- Enables Timer1 input capture on ICP1 (PD6)
+ * @param [in] 	- edge: @ref TIMER_CAPTURE_EDGE_define
+ * @param [in] 	- noise_canceler: @ref TIMER_NOISE_CANCELER_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 must run in normal or CTC mode (ICR1 is the TOP in PWM modes).
+ * 				  PD6 is set as input, enable TIMER_INTERRUPT_CAPTURE to be notified
+ */
+Std_Returntype TIMER_Capture_Init(uint8 edge, uint8 noise_canceler);
+
+/**=============================================
+ * @Fn			- TIMER_Capture_Set_Edge
+ * @brief 		- Changes the edge that triggers the capture
+ * @param [in] 	- edge: @ref TIMER_CAPTURE_EDGE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The capture flag is cleared, as changing the edge may set it.
+ * 				  Switching edges in the capture callback measures pulse widths
+ */
+Std_Returntype TIMER_Capture_Set_Edge(uint8 edge);
+
+/**=============================================
+ * @Fn			- TIMER_Get_Capture
+ * @brief 		- Reads the counter value latched by the last capture
+ * @param [out] - value: pointer to the variable that will return ICR1
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Get_Capture(uint16 *value);
+
+/**=============================================
+ * @Fn			- TIMER_Timebase_Init
+ * @brief 		- Starts Timer1 free running, extended to 32 bits by the overflow interrupt
+ * @param [in] 	- prescaler: @ref TIMER_PRESCALE_define (1 -> 1024)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 is owned by the timebase afterwards, input capture and compare
+ * 				  interrupts may still be used. Global interrupts are enabled
+ */
+Std_Returntype TIMER_Timebase_Init(uint8 prescaler);
+
+/**=============================================
+ * @Fn			- TIMER_Get_Timebase
+ * @brief 		- Returns the current value of the timebase
+ * @param [out] - ticks: pointer to the variable that will return the timebase in Timer1 ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Get_Timebase(uint32 *ticks);
+
+/**=============================================
+ * @Fn			- TIMER_Read_Timebase
+ * @brief 		- Returns the current value of the timebase from an ISR
+ * @retval 		- timebase in Timer1 ticks
+ * Note			- Must be called with interrupts disabled, accounts for an overflow that is
+ * 				  pending but not served yet. Inline so ISRs do not pay for a call
+ */
+static inline uint32 TIMER_Read_Timebase(void){
+	uint16 low = TIMER1->TCNT1;
+	uint16 high = TIMER_Timebase_High;
+	if((TIMERS_INT->TIFR.TOV1) && (low < 0x8000U))
+		high++;
+	return (((uint32)high << 16) | low);
+}
+
+#endif /* MCAL_TIMER_TIMER_INTERFACE_H_ */
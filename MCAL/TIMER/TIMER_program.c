@@ -0,0 +1,520 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : ITI_AVR_Drivers                                    	 */
+/* File          : TIMER_program.c                          			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "TIMER_interface.h"
+#include "../../SERVICES/BIT_MATH.h"
+
+#define TIMER_INVALID			0xFF
+
+/* Output compare and input capture pins */
+#define TIMER_OC0_PIN			3	/* PB3 */
+#define TIMER_OC1A_PIN			5	/* PD5 */
+#define TIMER_OC1B_PIN			4	/* PD4 */
+#define TIMER_OC2_PIN			7	/* PD7 */
+#define TIMER_ICP1_PIN			6	/* PD6 */
+
+#define TIMER_TOV1_BIT			2
+#define TIMER_ICF1_BIT			5
+#define TIMER1_CAPTURE_BITS		0xC0	/* ICNC1 and ICES1 of TCCR1B */
+
+/* CS bits of each @ref TIMER_PRESCALE_define */
+static const uint8 TIMER_Clock_Select[3][10] = {
+		{0, 1, 2, TIMER_INVALID, 3, TIMER_INVALID, 4, 5, 6, 7},
+		{0, 1, 2, TIMER_INVALID, 3, TIMER_INVALID, 4, 5, 6, 7},
+		{0, 1, 2, 3, 4, 5, 6, 7, TIMER_INVALID, TIMER_INVALID}
+};
+
+/* TIMSK / TIFR bit of each @ref TIMER_INTERRUPT_define */
+static const uint8 TIMER_Interrupt_Bit[3][TIMER_INTERRUPT_SOURCES] = {
+		{0, 1, TIMER_INVALID, TIMER_INVALID},
+		{2, 4, 3, 5},
+		{6, 7, TIMER_INVALID, TIMER_INVALID}
+};
+
+static const uint8 TIMER_Binding[3] = {TIMER0_BINDING, TIMER1_BINDING, TIMER2_BINDING};
+
+/* WGM bits of each @ref TIMER_MODE_define, Timer1 PWM modes use ICR1 as TOP */
+static const uint8 TIMER_8BIT_WGM[4] = {0x00, 0x08, 0x48, 0x40};
+static const uint8 TIMER1_WGM[4] = {0, 4, 14, 10};
+
+static void (*TIMER_Callback_Functions[3][TIMER_INTERRUPT_SOURCES])(void);
+
+/* Upper 16 bits of the timebase, read inline by TIMER_Read_Timebase */
+volatile uint16 TIMER_Timebase_High;
+static uint8 TIMER_Timebase_Active;
+
+/**=============================================
+ * @Fn			- TIMER_Init
+ * @brief 		- Configures the mode, compare values and outputs of a timer, then starts it
+ * @param [in] 	- _TIMER: Pointer to the timer configuration
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Connected output pins are set as outputs. Interrupts are not changed,
+ * 				  Timer1 must not be used while it runs the timebase
+ */
+Std_Returntype TIMER_Init(const TIMER_cfg *_TIMER){
+	Std_Returntype ret = RET_OK;
+	uint8 pwm, clock, tccr, wgm, sreg_state;
+	if((NULL == _TIMER) || (TIMER_2 < _TIMER->timer) || (TIMER_MODE_PHASE_CORRECT_PWM < _TIMER->mode) ||
+			(TIMER_PRESCALE_EXT_RISING < _TIMER->prescaler) ||
+			(TIMER_OUTPUT_SET < _TIMER->output_a) || (TIMER_OUTPUT_SET < _TIMER->output_b))
+		ret = RET_NOT_OK;
+	else{
+		pwm = (TIMER_MODE_FAST_PWM <= _TIMER->mode);
+		clock = TIMER_Clock_Select[_TIMER->timer][_TIMER->prescaler];
+		if((TIMER_INVALID == clock) ||
+				(pwm && ((TIMER_OUTPUT_TOGGLE == _TIMER->output_a) || (TIMER_OUTPUT_TOGGLE == _TIMER->output_b))))
+			ret = RET_NOT_OK;
+		else if(TIMER_1 == _TIMER->timer){
+			if(TIMER_Timebase_Active)
+				ret = RET_NOT_OK;
+			else{
+				wgm = TIMER1_WGM[_TIMER->mode];
+				/* Stopped while the registers change, the capture settings are kept */
+				TIMER1->TCCR1B.TCCR1B_REG &= TIMER1_CAPTURE_BITS;
+				TIMER1->TCCR1A.TCCR1A_REG = (_TIMER->output_a << 6) | (_TIMER->output_b << 4) | (wgm & 0x03);
+				sreg_state = SREG;
+				GLOBAL_INTERRUPT_DISABLE();
+				if(pwm)
+					TIMER1->ICR1 = _TIMER->period;
+				TIMER1->OCR1A = (TIMER_MODE_CTC == _TIMER->mode) ? _TIMER->period : _TIMER->compare_a;
+				TIMER1->OCR1B = _TIMER->compare_b;
+				TIMER1->TCNT1 = 0;
+				SREG = sreg_state;
+				if(TIMER_OUTPUT_DISCONNECTED != _TIMER->output_a)
+					SET_BIT(GPIOD->DDR, TIMER_OC1A_PIN);
+				if(TIMER_OUTPUT_DISCONNECTED != _TIMER->output_b)
+					SET_BIT(GPIOD->DDR, TIMER_OC1B_PIN);
+				TIMER1->TCCR1B.TCCR1B_REG |= ((wgm >> 2) << 3) | clock;
+			}
+		}
+		else if((0xFF < _TIMER->period) || (0xFF < _TIMER->compare_a) ||
+				(TIMER_OUTPUT_DISCONNECTED != _TIMER->output_b))
+			ret = RET_NOT_OK;
+		else{
+			tccr = (_TIMER->output_a << 4) | TIMER_8BIT_WGM[_TIMER->mode];
+			if(TIMER_0 == _TIMER->timer){
+				TIMER0->TCCR0.TCCR_REG = 0;
+				TIMER0->OCR0 = (TIMER_MODE_CTC == _TIMER->mode) ? _TIMER->period : _TIMER->compare_a;
+				TIMER0->TCNT0 = 0;
+				if(TIMER_OUTPUT_DISCONNECTED != _TIMER->output_a)
+					SET_BIT(GPIOB->DDR, TIMER_OC0_PIN);
+				TIMER0->TCCR0.TCCR_REG = tccr | clock;
+			}
+			else{
+				TIMER2->TCCR2.TCCR_REG = 0;
+				TIMER2->OCR2 = (TIMER_MODE_CTC == _TIMER->mode) ? _TIMER->period : _TIMER->compare_a;
+				TIMER2->TCNT2 = 0;
+				if(TIMER_OUTPUT_DISCONNECTED != _TIMER->output_a)
+					SET_BIT(GPIOD->DDR, TIMER_OC2_PIN);
+				TIMER2->TCCR2.TCCR_REG = tccr | clock;
+			}
+		}
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Start
+ * @brief 		- Starts a timer or changes its clock
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- prescaler: @ref TIMER_PRESCALE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 is rejected while it runs the timebase
+ */
+Std_Returntype TIMER_Start(uint8 timer, uint8 prescaler){
+	Std_Returntype ret = RET_OK;
+	uint8 clock;
+	if((TIMER_2 < timer) || (TIMER_PRESCALE_EXT_RISING < prescaler) ||
+			((TIMER_1 == timer) && TIMER_Timebase_Active) ||
+			(TIMER_INVALID == (clock = TIMER_Clock_Select[timer][prescaler])))
+		ret = RET_NOT_OK;
+	else if(TIMER_0 == timer)
+		TIMER0->TCCR0.CS = clock;
+	else if(TIMER_1 == timer)
+		TIMER1->TCCR1B.CS1 = clock;
+	else
+		TIMER2->TCCR2.CS = clock;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Stop
+ * @brief 		- Stops the clock of a timer, the counter keeps its value
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 is rejected while it runs the timebase
+ */
+Std_Returntype TIMER_Stop(uint8 timer){
+	return TIMER_Start(timer, TIMER_PRESCALE_STOP);
+}
+
+/**=============================================
+ * @Fn			- TIMER_Set_Counter
+ * @brief 		- Writes the counter of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- value: counter value, at most 0xFF for Timer0/Timer2
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Writing the counter blocks the compare match of the next timer clock.
+ * 				  Timer1 is rejected while it runs the timebase
+ */
+Std_Returntype TIMER_Set_Counter(uint8 timer, uint16 value){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((TIMER_2 < timer) || ((TIMER_1 != timer) && (0xFF < value)) ||
+			((TIMER_1 == timer) && TIMER_Timebase_Active))
+		ret = RET_NOT_OK;
+	else if(TIMER_0 == timer)
+		TIMER0->TCNT0 = value;
+	else if(TIMER_2 == timer)
+		TIMER2->TCNT2 = value;
+	else{
+		/* 16-bit registers share the TEMP register with the ISRs */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		TIMER1->TCNT1 = value;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Get_Counter
+ * @brief 		- Reads the counter of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [out] - value: pointer to the variable that will return the counter
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Get_Counter(uint8 timer, uint16 *value){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((TIMER_2 < timer) || (NULL == value))
+		ret = RET_NOT_OK;
+	else if(TIMER_0 == timer)
+		*value = TIMER0->TCNT0;
+	else if(TIMER_2 == timer)
+		*value = TIMER2->TCNT2;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		*value = TIMER1->TCNT1;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Set_Compare
+ * @brief 		- Writes a compare register (PWM duty or match value)
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- channel: @ref TIMER_CHANNEL_define
+ * @param [in] 	- value: compare value, at most the period (0xFF for Timer0/Timer2)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- In PWM modes the new value takes effect at the next TOP or BOTTOM (double buffered)
+ */
+Std_Returntype TIMER_Set_Compare(uint8 timer, uint8 channel, uint16 value){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if((TIMER_2 < timer) || (TIMER_CHANNEL_B < channel) ||
+			((TIMER_1 != timer) && ((0xFF < value) || (TIMER_CHANNEL_B == channel))))
+		ret = RET_NOT_OK;
+	else if(TIMER_0 == timer)
+		TIMER0->OCR0 = value;
+	else if(TIMER_2 == timer)
+		TIMER2->OCR2 = value;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		if(TIMER_CHANNEL_A == channel)
+			TIMER1->OCR1A = value;
+		else
+			TIMER1->OCR1B = value;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Set_Period
+ * @brief 		- Writes the TOP of a timer in CTC mode or Timer1 PWM modes
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- period: TOP value, the timer counts period + 1 clocks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- In CTC mode a period below the counter lets it run to the maximum once
+ */
+Std_Returntype TIMER_Set_Period(uint8 timer, uint16 period){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if(TIMER_1 == timer){
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		if(TIMER1->TCCR1B.WGM13)
+			TIMER1->ICR1 = period;
+		else if(TIMER1->TCCR1B.WGM12)
+			TIMER1->OCR1A = period;
+		else
+			ret = RET_NOT_OK;
+		SREG = sreg_state;
+	}
+	else if((TIMER_0 == timer) && (0xFF >= period) && TIMER0->TCCR0.WGM1 && !(TIMER0->TCCR0.WGM0))
+		TIMER0->OCR0 = period;
+	else if((TIMER_2 == timer) && (0xFF >= period) && TIMER2->TCCR2.WGM1 && !(TIMER2->TCCR2.WGM0))
+		TIMER2->OCR2 = period;
+	else
+		ret = RET_NOT_OK;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Set_Callback
+ * @brief 		- Sets the function called by an interrupt of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- source: @ref TIMER_INTERRUPT_define
+ * @param [in] 	- pf_callback: function called from the ISR, NULL to remove it
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The Timer1 overflow callback still runs when the timebase is used
+ */
+Std_Returntype TIMER_Set_Callback(uint8 timer, uint8 source, void (*pf_callback)(void)){
+	Std_Returntype ret = RET_OK;
+	if((TIMER_2 < timer) || (TIMER_INTERRUPT_SOURCES <= source) ||
+			(TIMER_INVALID == TIMER_Interrupt_Bit[timer][source]) ||
+			(TIMER_BINDING_STATIC == TIMER_Binding[timer]))
+		ret = RET_NOT_OK;
+	else
+		TIMER_Callback_Functions[timer][source] = pf_callback;
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Interrupt_Enable
+ * @brief 		- Clears the pending flag and enables an interrupt of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- source: @ref TIMER_INTERRUPT_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Global interrupts are enabled
+ */
+Std_Returntype TIMER_Interrupt_Enable(uint8 timer, uint8 source){
+	Std_Returntype ret = RET_OK;
+	uint8 bit, sreg_state;
+	if((TIMER_2 < timer) || (TIMER_INTERRUPT_SOURCES <= source) ||
+			(TIMER_INVALID == (bit = TIMER_Interrupt_Bit[timer][source])))
+		ret = RET_NOT_OK;
+	else{
+		TIMERS_INT->TIFR.TIFR_REG = (1U << bit); // Clear this flag only
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		SET_BIT(TIMERS_INT->TIMSK.TIMSK_REG, bit);
+		SREG = sreg_state;
+		GLOBAL_INTERRUPT_ENABLE();
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Interrupt_Disable
+ * @brief 		- Disables an interrupt of a timer
+ * @param [in] 	- timer: @ref TIMER_NUMBER_define
+ * @param [in] 	- source: @ref TIMER_INTERRUPT_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Interrupt_Disable(uint8 timer, uint8 source){
+	Std_Returntype ret = RET_OK;
+	uint8 bit, sreg_state;
+	if((TIMER_2 < timer) || (TIMER_INTERRUPT_SOURCES <= source) ||
+			(TIMER_INVALID == (bit = TIMER_Interrupt_Bit[timer][source])) ||
+			((TIMER_1 == timer) && (TIMER_INTERRUPT_OVERFLOW == source) && TIMER_Timebase_Active))
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		CLR_BIT(TIMERS_INT->TIMSK.TIMSK_REG, bit);
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Capture_Init
+ * @brief 		- Enables Timer1 input capture on ICP1 (PD6)
+ * @param [in] 	- edge: @ref TIMER_CAPTURE_EDGE_define
+ * @param [in] 	- noise_canceler: @ref TIMER_NOISE_CANCELER_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 must run in normal or CTC mode (ICR1 is the TOP in PWM modes).
+ * 				  PD6 is set as input, enable TIMER_INTERRUPT_CAPTURE to be notified
+ */
+Std_Returntype TIMER_Capture_Init(uint8 edge, uint8 noise_canceler){
+	Std_Returntype ret = RET_OK;
+	if((TIMER_CAPTURE_RISING < edge) || (TIMER_NOISE_CANCELER_ON < noise_canceler) || (TIMER1->TCCR1B.WGM13))
+		ret = RET_NOT_OK;
+	else{
+		CLR_BIT(GPIOD->DDR, TIMER_ICP1_PIN);
+		TIMER1->TCCR1B.ICNC1 = noise_canceler;
+		TIMER1->TCCR1B.ICES1 = edge;
+		TIMERS_INT->TIFR.TIFR_REG = (1U << TIMER_ICF1_BIT); // Clear ICF1 only
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Capture_Set_Edge
+ * @brief 		- Changes the edge that triggers the capture
+ * @param [in] 	- edge: @ref TIMER_CAPTURE_EDGE_define
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- The capture flag is cleared, as changing the edge may set it.
+ * 				  Switching edges in the capture callback measures pulse widths
+ */
+Std_Returntype TIMER_Capture_Set_Edge(uint8 edge){
+	Std_Returntype ret = RET_OK;
+	if(TIMER_CAPTURE_RISING < edge)
+		ret = RET_NOT_OK;
+	else{
+		TIMER1->TCCR1B.ICES1 = edge;
+		TIMERS_INT->TIFR.TIFR_REG = (1U << TIMER_ICF1_BIT);
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Get_Capture
+ * @brief 		- Reads the counter value latched by the last capture
+ * @param [out] - value: pointer to the variable that will return ICR1
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Get_Capture(uint16 *value){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if(NULL == value)
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		*value = TIMER1->ICR1;
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Timebase_Init
+ * @brief 		- Starts Timer1 free running, extended to 32 bits by the overflow interrupt
+ * @param [in] 	- prescaler: @ref TIMER_PRESCALE_define (1 -> 1024)
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- Timer1 is owned by the timebase afterwards, input capture and compare
+ * 				  interrupts may still be used. Global interrupts are enabled
+ */
+Std_Returntype TIMER_Timebase_Init(uint8 prescaler){
+	Std_Returntype ret = RET_OK;
+	uint8 clock, sreg_state;
+	if((TIMER_BINDING_STATIC == TIMER1_BINDING) || (TIMER_PRESCALE_1 > prescaler) || (TIMER_PRESCALE_1024 < prescaler) ||
+			(TIMER_INVALID == (clock = TIMER_Clock_Select[TIMER_1][prescaler])))
+		ret = RET_NOT_OK;
+	else{
+		/* Normal mode, counter runs from 0 to 0xFFFF, the capture settings are kept */
+		TIMER1->TCCR1B.TCCR1B_REG &= TIMER1_CAPTURE_BITS;
+		TIMER1->TCCR1A.TCCR1A_REG = 0;
+		/* 16-bit registers share the TEMP register with the ISRs */
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		TIMER1->TCNT1 = 0;
+		TIMER_Timebase_High = 0;
+		SREG = sreg_state;
+		TIMER_Timebase_Active = 1;
+		TIMERS_INT->TIFR.TIFR_REG = (1U << TIMER_TOV1_BIT); // Clear TOV1 only
+		TIMERS_INT->TIMSK.TOIE1 = 1;
+		TIMER1->TCCR1B.CS1 = clock;
+		GLOBAL_INTERRUPT_ENABLE();
+	}
+	return ret;
+}
+
+/**=============================================
+ * @Fn			- TIMER_Get_Timebase
+ * @brief 		- Returns the current value of the timebase
+ * @param [out] - ticks: pointer to the variable that will return the timebase in Timer1 ticks
+ * @retval 		- return RET_OK if operation was successful, and returns RET_NOT_OK if an error happened
+ * Note			- None
+ */
+Std_Returntype TIMER_Get_Timebase(uint32 *ticks){
+	Std_Returntype ret = RET_OK;
+	uint8 sreg_state;
+	if(NULL == ticks)
+		ret = RET_NOT_OK;
+	else{
+		sreg_state = SREG;
+		GLOBAL_INTERRUPT_DISABLE();
+		*ticks = TIMER_Read_Timebase();
+		SREG = sreg_state;
+	}
+	return ret;
+}
+
+#if (TIMER_BINDING_RUNTIME == TIMER2_BINDING)
+/* TIMER2_COMP_ISR */
+void __vector_4(void) __attribute__((signal));
+void __vector_4(void){
+	if(TIMER_Callback_Functions[TIMER_2][TIMER_INTERRUPT_COMPARE_A])
+		TIMER_Callback_Functions[TIMER_2][TIMER_INTERRUPT_COMPARE_A]();
+}
+
+/* TIMER2_OVF_ISR */
+void __vector_5(void) __attribute__((signal));
+void __vector_5(void){
+	if(TIMER_Callback_Functions[TIMER_2][TIMER_INTERRUPT_OVERFLOW])
+		TIMER_Callback_Functions[TIMER_2][TIMER_INTERRUPT_OVERFLOW]();
+}
+#endif
+
+#if (TIMER_BINDING_RUNTIME == TIMER1_BINDING)
+/* TIMER1_CAPT_ISR */
+void __vector_6(void) __attribute__((signal));
+void __vector_6(void){
+	if(TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_CAPTURE])
+		TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_CAPTURE]();
+}
+
+/* TIMER1_COMPA_ISR */
+void __vector_7(void) __attribute__((signal));
+void __vector_7(void){
+	if(TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_COMPARE_A])
+		TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_COMPARE_A]();
+}
+
+/* TIMER1_COMPB_ISR */
+void __vector_8(void) __attribute__((signal));
+void __vector_8(void){
+	if(TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_COMPARE_B])
+		TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_COMPARE_B]();
+}
+
+/* TIMER1_OVF_ISR, extends the timebase */
+void __vector_9(void) __attribute__((signal));
+void __vector_9(void){
+	TIMER_Timebase_High++;
+	if(TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_OVERFLOW])
+		TIMER_Callback_Functions[TIMER_1][TIMER_INTERRUPT_OVERFLOW]();
+}
+#endif
+
+#if (TIMER_BINDING_RUNTIME == TIMER0_BINDING)
+/* TIMER0_COMP_ISR */
+void __vector_10(void) __attribute__((signal));
+void __vector_10(void){
+	if(TIMER_Callback_Functions[TIMER_0][TIMER_INTERRUPT_COMPARE_A])
+		TIMER_Callback_Functions[TIMER_0][TIMER_INTERRUPT_COMPARE_A]();
+}
+
+/* TIMER0_OVF_ISR */
+void __vector_11(void) __attribute__((signal));
+void __vector_11(void){
+	if(TIMER_Callback_Functions[TIMER_0][TIMER_INTERRUPT_OVERFLOW])
+		TIMER_Callback_Functions[TIMER_0][TIMER_INTERRUPT_OVERFLOW]();
+}
+#endif